@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BoardBatch.h"
+#include "ProfileManager.h"
+#include "ScoreManager.h"
+#include "TicTacToe.h"
+#include "TicTacToeTablebase.h"
+
+using namespace std;
+
+// Keeps results observable so the optimizer cannot drop the work being timed
+static volatile long long sink = 0;
+
+template <typename Body>
+void bench(const string &name, int iterations, Body body)
+{
+    for (int i = 0; i < iterations / 10; i++)
+        body(i);
+
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        body(i);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << left << setw(28) << name << right << setw(12) << fixed << setprecision(1)
+         << seconds * 1e9 / iterations << " ns/op\n";
+}
+
+// Random reachable positions with the game still in progress
+static vector<string> samplePositions(int count, mt19937 &rng)
+{
+    vector<string> positions;
+    while ((int)positions.size() < count)
+    {
+        string board = "         ";
+        int moves = rng() % 7;
+        char mark = 'X';
+        bool over = false;
+        for (int m = 0; m < moves && !over; m++)
+        {
+            int cell;
+            do
+                cell = rng() % 9;
+            while (board[cell] != ' ');
+            board[cell] = mark;
+            mark = (mark == 'X') ? 'O' : 'X';
+            over = BoardBatch::evaluateOne(BoardBatch::toMask(board.c_str(), 'X'), BoardBatch::toMask(board.c_str(), 'O')) != BoardBatch::ONGOING;
+        }
+        if (!over)
+            positions.push_back(board);
+    }
+    return positions;
+}
+
+int main(int argc, char *argv[])
+{
+    int scale = (argc > 1) ? atoi(argv[1]) : 1;
+    if (scale < 1)
+        scale = 1;
+
+    mt19937 rng(12345);
+    vector<string> positions = samplePositions(1024, rng);
+
+    TicTacToe ai;
+    ai.seed(1);
+    bench("minimax search", 200 * scale, [&](int i)
+    {
+        const string &board = positions[i % positions.size()];
+        int xs = count(board.begin(), board.end(), 'X');
+        int os = count(board.begin(), board.end(), 'O');
+        sink += ai.chooseMove(board.c_str(), xs == os ? 'X' : 'O', TicTacToe::MINIMAX_ENGINE);
+    });
+
+    TicTacToeTablebase tablebase;
+    tablebase.open("tictactoe.tb");
+    bench("tablebase probe", 2000000 * scale, [&](int i)
+    {
+        sink += tablebase.bestMove(positions[i % positions.size()].c_str());
+    });
+
+    vector<uint16_t> xMasks(positions.size());
+    vector<uint16_t> oMasks(positions.size());
+    for (size_t p = 0; p < positions.size(); p++)
+    {
+        xMasks[p] = BoardBatch::toMask(positions[p].c_str(), 'X');
+        oMasks[p] = BoardBatch::toMask(positions[p].c_str(), 'O');
+    }
+    vector<unsigned char> status(positions.size());
+    bench("BoardBatch evaluate x1024", 20000 * scale, [&](int)
+    {
+        BoardBatch::evaluate(xMasks.data(), oMasks.data(), (int)positions.size(), status.data());
+        sink += status[0];
+    });
+
+    vector<string> names;
+    for (int n = 0; n < 500; n++)
+        names.push_back("Player" + to_string(n));
+
+    ScoreManager scoreManager;
+    bench("saveScore", 200000 * scale, [&](int i)
+    {
+        scoreManager.saveScore("TicTacToe", names[i % names.size()], i % 97, i & 1);
+    });
+
+    ProfileManager profiles;
+    bench("profile append", 1000000 * scale, [&](int i)
+    {
+        profiles.recordMatch(names[i % 50], "RockPaperScissors", i % 10, i & 1, 1700000000 + i * 60LL);
+    });
+
+    return 0;
+}
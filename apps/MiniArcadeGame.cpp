@@ -0,0 +1,107 @@
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+
+#include "Console.h"
+#include "Metrics.h"
+#include "NumberGuessing.h"
+#include "RockPaperScissors.h"
+#include "ScoreManager.h"
+#include "TicTacToe.h"
+#include "TicTacToeTablebase.h"
+
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1 && string(argv[1]) == "--build-tablebase")
+    {
+        string path = (argc > 2) ? argv[2] : "tictactoe.tb";
+        if (!TicTacToeTablebase::writeFile(path, TicTacToeTablebase::generate()))
+        {
+            cout << "Could not write tablebase to " << path << "\n";
+            return 1;
+        }
+        cout << "Tablebase written to " << path << "\n";
+        return 0;
+    }
+
+#ifdef ARCADE_METRICS
+    string tracePath;
+    if (argc > 2 && string(argv[1]) == "--trace")
+    {
+        tracePath = argv[2];
+        Metrics::tracing() = true;
+    }
+#endif
+
+    srand(time(0));
+    ScoreManager scoreManager;
+    RockPaperScissors rpsGame;
+    TicTacToe tttGame;
+    NumberGuessing ngGame;
+
+    int choice = 0;
+
+    while (choice != 7)
+    {
+        clearScreen();
+        cout << "  +----------------------------------+\n";
+        cout << "  |     SELECT A GAME TO PLAY        |\n";
+        cout << "  +----------------------------------+\n";
+        cout << "  | 1. Rock-Paper-Scissors           |\n";
+        cout << "  | 2. Tic-Tac-Toe                   |\n";
+        cout << "  | 3. Number Guessing               |\n";
+        cout << "  +----------------------------------+\n";
+        cout << "  |     OTHER OPTIONS                |\n";
+        cout << "  +----------------------------------+\n";
+        cout << "  | 4. View High Scores              |\n";
+        cout << "  | 5. Reset High Scores             |\n";
+        cout << "  | 6. View Player Profile           |\n";
+        cout << "  | 7. Exit                          |\n";
+        cout << "  +----------------------------------+\n\n";
+
+        cout << "  Enter your choice: ";
+        readInput(choice);
+
+        switch (choice)
+        {
+        case 1:
+            rpsGame.play(scoreManager);
+            break;
+        case 2:
+            tttGame.play(scoreManager);
+            break;
+        case 3:
+            ngGame.play(scoreManager);
+            break;
+        case 4:
+            scoreManager.showAllHighScores();
+            break;
+        case 5:
+            scoreManager.resetAllScores();
+            break;
+        case 6:
+            scoreManager.showPlayerProfile();
+            break;
+        case 7:
+            clearScreen();
+            cout << "\n"
+                 << rule('=', 55) << "\n";
+            cout << "      Thanks for playing! Goodbye!\n";
+            cout << rule('=', 55) << "\n\n";
+            break;
+        default:
+            cout << "Invalid choice! Please try again.\n";
+            sleepMs(1500);
+            break;
+        }
+    }
+
+#ifdef ARCADE_METRICS
+    Metrics::writePrometheus("metrics.prom");
+    if (!tracePath.empty())
+        Metrics::writeTrace(tracePath);
+#endif
+}
@@ -0,0 +1,30 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "Metrics.h"
+#include "Tournament.h"
+
+using namespace std;
+
+// Headless self-play: runs an engine tournament with no console I/O. This is
+// also the training workload for profile-guided builds (see the pgo-train target).
+int main(int argc, char *argv[])
+{
+    string format = (argc > 1) ? argv[1] : "round-robin";
+    if (format != "round-robin" && format != "gauntlet")
+    {
+        cout << "Usage: arcade_simulator [round-robin|gauntlet] [maxGames=20000] [report=tournament.txt] [threads=cores]\n";
+        return 1;
+    }
+    int maxGames = (argc > 2) ? atoi(argv[2]) : 20000;
+    string reportPath = (argc > 3) ? argv[3] : "tournament.txt";
+    int threads = (argc > 4) ? atoi(argv[4]) : 0;
+
+    Tournament tournament(format == "gauntlet", maxGames, threads);
+    bool ok = tournament.run(reportPath);
+#ifdef ARCADE_METRICS
+    Metrics::writePrometheus("metrics.prom");
+#endif
+    return ok ? 0 : 1;
+}
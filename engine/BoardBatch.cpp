@@ -0,0 +1,109 @@
+#include "BoardBatch.h"
+
+// AVX2 builds keep the SSE2 loops for the 8-wide remainder, so a minimax node
+// (at most 9 children) is still vectorized when there are fewer than 16 positions.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BATCH_AVX2
+#define BATCH_SSE2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BATCH_SSE2
+#endif
+
+static const uint16_t LINES[8] = {0x007, 0x038, 0x1C0, 0x049, 0x092, 0x124, 0x111, 0x054};
+
+unsigned char BoardBatch::evaluateOne(uint16_t xMask, uint16_t oMask)
+{
+    bool xWin = false;
+    bool oWin = false;
+    for (int i = 0; i < 8; i++)
+    {
+        xWin |= (xMask & LINES[i]) == LINES[i];
+        oWin |= (oMask & LINES[i]) == LINES[i];
+    }
+    if (xWin)
+        return X_WINS;
+    if (oWin)
+        return O_WINS;
+    if ((xMask | oMask) == FULL_BOARD)
+        return DRAW;
+    return ONGOING;
+}
+
+void BoardBatch::evaluate(const uint16_t *xMasks, const uint16_t *oMasks, int count, unsigned char *status)
+{
+    int i = 0;
+#if defined(BATCH_AVX2)
+    const __m256i full256 = _mm256_set1_epi16(FULL_BOARD);
+    for (; i + 16 <= count; i += 16)
+    {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(xMasks + i));
+        __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(oMasks + i));
+        __m256i xWin = _mm256_setzero_si256();
+        __m256i oWin = _mm256_setzero_si256();
+        for (int l = 0; l < 8; l++)
+        {
+            __m256i line = _mm256_set1_epi16(LINES[l]);
+            xWin = _mm256_or_si256(xWin, _mm256_cmpeq_epi16(_mm256_and_si256(x, line), line));
+            oWin = _mm256_or_si256(oWin, _mm256_cmpeq_epi16(_mm256_and_si256(o, line), line));
+        }
+        __m256i isFull = _mm256_cmpeq_epi16(_mm256_or_si256(x, o), full256);
+        __m256i anyWin = _mm256_or_si256(xWin, oWin);
+        __m256i result = _mm256_and_si256(xWin, _mm256_set1_epi16(X_WINS));
+        result = _mm256_or_si256(result, _mm256_andnot_si256(xWin, _mm256_and_si256(oWin, _mm256_set1_epi16(O_WINS))));
+        result = _mm256_or_si256(result, _mm256_andnot_si256(anyWin, _mm256_and_si256(isFull, _mm256_set1_epi16(DRAW))));
+        __m128i packed = _mm_packus_epi16(_mm256_castsi256_si128(result), _mm256_extracti128_si256(result, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(status + i), packed);
+    }
+#endif
+#if defined(BATCH_SSE2)
+    const __m128i full = _mm_set1_epi16(FULL_BOARD);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(xMasks + i));
+        __m128i o = _mm_loadu_si128(reinterpret_cast<const __m128i *>(oMasks + i));
+        __m128i xWin = _mm_setzero_si128();
+        __m128i oWin = _mm_setzero_si128();
+        for (int l = 0; l < 8; l++)
+        {
+            __m128i line = _mm_set1_epi16(LINES[l]);
+            xWin = _mm_or_si128(xWin, _mm_cmpeq_epi16(_mm_and_si128(x, line), line));
+            oWin = _mm_or_si128(oWin, _mm_cmpeq_epi16(_mm_and_si128(o, line), line));
+        }
+        __m128i isFull = _mm_cmpeq_epi16(_mm_or_si128(x, o), full);
+        __m128i anyWin = _mm_or_si128(xWin, oWin);
+        __m128i result = _mm_and_si128(xWin, _mm_set1_epi16(X_WINS));
+        result = _mm_or_si128(result, _mm_andnot_si128(xWin, _mm_and_si128(oWin, _mm_set1_epi16(O_WINS))));
+        result = _mm_or_si128(result, _mm_andnot_si128(anyWin, _mm_and_si128(isFull, _mm_set1_epi16(DRAW))));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(status + i), _mm_packus_epi16(result, _mm_setzero_si128()));
+    }
+#endif
+    for (; i < count; i++)
+        status[i] = evaluateOne(xMasks[i], oMasks[i]);
+}
+
+void BoardBatch::legalMoves(const uint16_t *xMasks, const uint16_t *oMasks, int count, uint16_t *moves)
+{
+    int i = 0;
+#if defined(BATCH_AVX2)
+    const __m256i full256 = _mm256_set1_epi16(FULL_BOARD);
+    for (; i + 16 <= count; i += 16)
+    {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(xMasks + i));
+        __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(oMasks + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(moves + i), _mm256_andnot_si256(_mm256_or_si256(x, o), full256));
+    }
+#endif
+#if defined(BATCH_SSE2)
+    const __m128i full = _mm_set1_epi16(FULL_BOARD);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(xMasks + i));
+        __m128i o = _mm_loadu_si128(reinterpret_cast<const __m128i *>(oMasks + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(moves + i), _mm_andnot_si128(_mm_or_si128(x, o), full));
+    }
+#endif
+    for (; i < count; i++)
+        moves[i] = ~(xMasks[i] | oMasks[i]) & FULL_BOARD;
+}
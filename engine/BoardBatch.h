@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+
+// Evaluates many Tic-Tac-Toe positions at once. A position is a pair of 9-bit
+// masks (bit i set = that player owns cell i), so a win test is one AND and one
+// compare per line, done for 16 (AVX2) or 8 (SSE2) positions per instruction.
+class BoardBatch
+{
+public:
+    enum Status
+    {
+        ONGOING = 0,
+        X_WINS,
+        O_WINS,
+        DRAW
+    };
+
+    static const uint16_t FULL_BOARD = 0x1FF;
+
+    // Inline because Minimax calls it twice per node
+    static uint16_t toMask(const char board[9], char mark)
+    {
+        uint16_t mask = 0;
+        for (int i = 0; i < 9; i++)
+        {
+            if (board[i] == mark)
+                mask |= 1 << i;
+        }
+        return mask;
+    }
+
+    static unsigned char evaluateOne(uint16_t xMask, uint16_t oMask);
+
+    // Writes one Status per position into status[0..count)
+    static void evaluate(const uint16_t *xMasks, const uint16_t *oMasks, int count, unsigned char *status);
+
+    // Writes the mask of empty cells for each position into moves[0..count)
+    static void legalMoves(const uint16_t *xMasks, const uint16_t *oMasks, int count, uint16_t *moves);
+};
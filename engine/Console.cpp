@@ -0,0 +1,35 @@
+#include "Console.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <thread>
+
+using namespace std;
+
+Rule rule(char fill, int width)
+{
+    return Rule{fill, width};
+}
+
+ostream &operator<<(ostream &out, const Rule &r)
+{
+    char oldFill = out.fill(r.fill);
+    out << setw(r.width) << "";
+    out.fill(oldFill);
+    return out;
+}
+
+void clearScreen()
+{
+#ifdef _WIN32
+    system("cls");
+#else
+    cout << "\033[2J\033[H" << flush;
+#endif
+}
+
+void sleepMs(int milliseconds)
+{
+    this_thread::sleep_for(chrono::milliseconds(milliseconds));
+}
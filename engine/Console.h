@@ -0,0 +1,26 @@
+#pragma once
+
+#include <iostream>
+
+#include "Metrics.h"
+
+// Prints a horizontal rule without building a temporary string every frame
+struct Rule
+{
+    char fill;
+    int width;
+};
+
+Rule rule(char fill, int width);
+std::ostream &operator<<(std::ostream &out, const Rule &r);
+
+void clearScreen();
+void sleepMs(int milliseconds);
+
+// Reads one value from the player, timing how long the game sat waiting for it
+template <typename T>
+void readInput(T &value)
+{
+    METRIC_SCOPE(INPUT_WAIT_TIME);
+    std::cin >> value;
+}
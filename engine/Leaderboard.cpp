@@ -0,0 +1,106 @@
+#include "Leaderboard.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "Console.h"
+
+using namespace std;
+
+Leaderboard::Leaderboard(pmr::memory_resource *resource) : entries(resource), order(resource), rankOf(resource), index(resource), rowCache(resource), rowValid(resource) {}
+
+// Scores and wins only grow, so an updated entry can only move up the table
+void Leaderboard::promote(int entry)
+{
+    int oldRank = rankOf[entry];
+    auto better = [this](int a, int b)
+    {
+        return compScores(entries[a], entries[b]);
+    };
+    int newRank = upper_bound(order.begin(), order.begin() + oldRank, entry, better) - order.begin();
+
+    rotate(order.begin() + newRank, order.begin() + oldRank, order.begin() + oldRank + 1);
+    for (int rank = newRank; rank <= oldRank; rank++)
+    {
+        rankOf[order[rank]] = rank;
+        rowValid[rank] = 0;
+    }
+}
+
+const pmr::string &Leaderboard::row(int rank) const
+{
+    if (!rowValid[rank])
+    {
+        const PlayerScore &player = entries[order[rank]];
+        ostringstream line;
+        line << left << setw(6) << (rank + 1) << setw(20) << player.name << setw(10) << player.score << setw(10) << player.gamesPlayed << player.wins << "\n";
+        rowCache[rank] = line.str();
+        rowValid[rank] = 1;
+    }
+    return rowCache[rank];
+}
+
+void Leaderboard::add(string_view playerName, int score, int wins)
+{
+    int entry = findByName(index, playerName);
+    if (entry == -1)
+    {
+        entry = entries.size();
+        entries.emplace_back(playerName, score, 1, wins);
+        index.emplace(pmr::string(playerName, index.get_allocator().resource()), entry);
+        rankOf.push_back(order.size());
+        order.push_back(entry);
+        rowCache.emplace_back();
+        rowValid.push_back(0);
+    }
+    else
+    {
+        PlayerScore &player = entries[entry];
+        player.score += score;
+        player.gamesPlayed++;
+        player.wins += wins;
+    }
+    promote(entry);
+}
+
+int Leaderboard::size() const
+{
+    return order.size();
+}
+
+int Leaderboard::rankOfPlayer(string_view playerName) const
+{
+    int entry = findByName(index, playerName);
+    return (entry == -1) ? -1 : rankOf[entry];
+}
+
+void Leaderboard::displayPage(const string &title, int firstRank, int pageSize) const
+{
+    cout << "\n--- " << title << " ---\n";
+    cout << left << setw(6) << "Rank" << setw(20) << "Player" << setw(10) << "Score" << setw(10) << "Games" << "Wins" << "\n";
+    cout << rule('-', 56) << "\n";
+
+    if (order.empty())
+    {
+        cout << "No scores yet!\n";
+        return;
+    }
+
+    int lastRank = min(firstRank + pageSize, size());
+    for (int rank = firstRank; rank < lastRank; rank++)
+        cout << row(rank);
+    cout << "(" << (firstRank + 1) << "-" << lastRank << " of " << size() << ")\n";
+}
+
+void Leaderboard::clear()
+{
+    pmr::memory_resource *resource = entries.get_allocator().resource();
+    entries = pmr::vector<PlayerScore>(resource);
+    order = pmr::vector<int>(resource);
+    rankOf = pmr::vector<int>(resource);
+    index = NameIndex(resource);
+    rowCache = pmr::vector<pmr::string>(resource);
+    rowValid = pmr::vector<char>(resource);
+}
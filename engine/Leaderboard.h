@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "PlayerScore.h"
+
+// One game's rankings. `order` maps rank to entry and `rankOf` maps back, so
+// an update only touches the ranks it moves across. Formatted rows are cached
+// per rank and rebuilt only for ranks whose occupant or stats changed, so a
+// page costs O(page size) however many players there are.
+class Leaderboard
+{
+private:
+    std::pmr::vector<PlayerScore> entries;
+    std::pmr::vector<int> order;
+    std::pmr::vector<int> rankOf;
+    NameIndex index;
+    mutable std::pmr::vector<std::pmr::string> rowCache;
+    mutable std::pmr::vector<char> rowValid;
+
+    void promote(int entry);
+    const std::pmr::string &row(int rank) const;
+
+public:
+    Leaderboard(std::pmr::memory_resource *resource);
+
+    void add(std::string_view playerName, int score, int wins);
+    int size() const;
+
+    // 0-based rank of the player, or -1 if they have no score yet
+    int rankOfPlayer(std::string_view playerName) const;
+
+    void displayPage(const std::string &title, int firstRank, int pageSize) const;
+
+    // Hands every allocation back to the memory resource
+    void clear();
+};
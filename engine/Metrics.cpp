@@ -0,0 +1,145 @@
+#include "Metrics.h"
+
+#ifdef ARCADE_METRICS
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+
+using namespace std;
+
+static const char *const COUNTER_NAMES[Metrics::COUNTER_COUNT] = {"ai_moves", "minimax_nodes", "tablebase_probes"};
+static const char *const HISTOGRAM_NAMES[Metrics::HISTOGRAM_COUNT] = {"ai_move", "save_score", "frame_render", "input_wait"};
+
+static mutex &registryMutex()
+{
+    static mutex m;
+    return m;
+}
+
+bool &Metrics::tracing()
+{
+    static bool enabled = false;
+    return enabled;
+}
+
+vector<Metrics::ThreadData *> &Metrics::liveThreads()
+{
+    static vector<ThreadData *> threads;
+    return threads;
+}
+
+// Totals of threads that have already exited
+Metrics::Snapshot &Metrics::retired()
+{
+    static Snapshot snapshot;
+    return snapshot;
+}
+
+Metrics::ThreadData::ThreadData()
+{
+    static int nextThreadId = 1;
+    lock_guard<mutex> lock(registryMutex());
+    threadId = nextThreadId++;
+    liveThreads().push_back(this);
+}
+
+Metrics::ThreadData::~ThreadData()
+{
+    lock_guard<mutex> lock(registryMutex());
+    retired().merge(*this, true);
+    vector<ThreadData *> &live = liveThreads();
+    live.erase(find(live.begin(), live.end(), this));
+}
+
+void Metrics::Snapshot::merge(const ThreadData &data, bool withTrace)
+{
+    for (int c = 0; c < COUNTER_COUNT; c++)
+        counters[c] += data.counters[c].load(memory_order_relaxed);
+    for (int h = 0; h < HISTOGRAM_COUNT; h++)
+    {
+        sums[h] += data.sums[h].load(memory_order_relaxed);
+        for (int b = 0; b < BUCKETS; b++)
+            buckets[h][b] += data.buckets[h][b].load(memory_order_relaxed);
+    }
+    if (withTrace)
+    {
+        for (const TraceEvent &event : data.trace)
+            trace.emplace_back(data.threadId, event);
+    }
+}
+
+uint64_t Metrics::bucketUpperBound(int index)
+{
+    if (index < SUB_BUCKETS)
+        return index;
+    int exponent = index / SUB_BUCKETS + 2;
+    uint64_t sub = index % SUB_BUCKETS;
+    return ((SUB_BUCKETS + sub + 1) << (exponent - 3)) - 1;
+}
+
+Metrics::Snapshot Metrics::collect(bool withTrace)
+{
+    lock_guard<mutex> lock(registryMutex());
+    Snapshot snapshot = retired();
+    if (!withTrace)
+        snapshot.trace.clear();
+    for (const ThreadData *data : liveThreads())
+        snapshot.merge(*data, withTrace);
+    return snapshot;
+}
+
+bool Metrics::writePrometheus(const string &path)
+{
+    Snapshot snapshot = collect(false);
+    ofstream out(path, ios::trunc);
+    if (!out)
+        return false;
+
+    for (int c = 0; c < COUNTER_COUNT; c++)
+    {
+        out << "# TYPE arcade_" << COUNTER_NAMES[c] << "_total counter\n";
+        out << "arcade_" << COUNTER_NAMES[c] << "_total " << snapshot.counters[c] << "\n";
+    }
+
+    for (int h = 0; h < HISTOGRAM_COUNT; h++)
+    {
+        string name = string("arcade_") + HISTOGRAM_NAMES[h] + "_seconds";
+        uint64_t cumulative = 0;
+        out << "# TYPE " << name << " histogram\n";
+        for (int b = 0; b < BUCKETS; b++)
+        {
+            if (snapshot.buckets[h][b] == 0)
+                continue;
+            cumulative += snapshot.buckets[h][b];
+            out << name << "_bucket{le=\"" << bucketUpperBound(b) / 1e9 << "\"} " << cumulative << "\n";
+        }
+        out << name << "_bucket{le=\"+Inf\"} " << cumulative << "\n";
+        out << name << "_sum " << snapshot.sums[h] / 1e9 << "\n";
+        out << name << "_count " << cumulative << "\n";
+    }
+    return bool(out);
+}
+
+bool Metrics::writeTrace(const string &path)
+{
+    Snapshot snapshot = collect(true);
+    ofstream out(path, ios::trunc);
+    if (!out)
+        return false;
+
+    out << "{\"traceEvents\":[";
+    for (size_t i = 0; i < snapshot.trace.size(); i++)
+    {
+        const TraceEvent &event = snapshot.trace[i].second;
+        out << (i ? ",\n" : "\n") << "{\"name\":\"" << HISTOGRAM_NAMES[event.histogram]
+            << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << snapshot.trace[i].first
+            << ",\"ts\":" << fixed << setprecision(3) << event.start / 1000.0
+            << ",\"dur\":" << event.duration / 1000.0 << "}";
+    }
+    out << "\n]}\n";
+    return bool(out);
+}
+
+#endif
@@ -0,0 +1,153 @@
+#pragma once
+
+// Instrumentation is compiled in only with -DARCADE_METRICS; otherwise every
+// METRIC_* macro expands to nothing.
+#ifdef ARCADE_METRICS
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+class Metrics
+{
+public:
+    enum Counter
+    {
+        AI_MOVES,
+        MINIMAX_NODES,
+        TABLEBASE_PROBES,
+        COUNTER_COUNT
+    };
+
+    enum Histogram
+    {
+        AI_MOVE_TIME,
+        SAVE_SCORE_TIME,
+        FRAME_RENDER_TIME, // drawing one screen after it is cleared, up to the input prompt
+        INPUT_WAIT_TIME,
+        HISTOGRAM_COUNT
+    };
+
+    // Log-linear (HDR-style) buckets: exact below 8ns, then 8 sub-buckets per
+    // power of two, so every bucket is within 12.5% of its value.
+    static const int SUB_BUCKETS = 8;
+    static const int BUCKETS = 62 * SUB_BUCKETS;
+
+    static void count(Counter counter, uint64_t n)
+    {
+        add(local().counters[counter], n);
+    }
+
+    static void record(Histogram histogram, int64_t start, int64_t duration)
+    {
+        ThreadData &data = local();
+        add(data.buckets[histogram][bucketIndex(duration)], 1);
+        add(data.sums[histogram], duration);
+        if (tracing())
+            data.trace.push_back(TraceEvent{histogram, start, duration});
+    }
+
+    static int64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static bool &tracing();
+
+    class ScopedTimer
+    {
+    private:
+        Histogram histogram;
+        int64_t start;
+
+    public:
+        ScopedTimer(Histogram h) : histogram(h), start(now()) {}
+        ~ScopedTimer()
+        {
+            record(histogram, start, now() - start);
+        }
+    };
+
+    static bool writePrometheus(const std::string &path);
+
+    // Chrome trace-event JSON (load in chrome://tracing or Perfetto). Call once
+    // worker threads have been joined; events are read without synchronisation.
+    static bool writeTrace(const std::string &path);
+
+private:
+    struct TraceEvent
+    {
+        Histogram histogram;
+        int64_t start;
+        int64_t duration;
+    };
+
+    // Each thread only ever writes its own slots, so recording is a relaxed
+    // load and store; readers merge all threads under the registry lock.
+    struct ThreadData
+    {
+        std::atomic<uint64_t> counters[COUNTER_COUNT] = {};
+        std::atomic<uint64_t> buckets[HISTOGRAM_COUNT][BUCKETS] = {};
+        std::atomic<uint64_t> sums[HISTOGRAM_COUNT] = {};
+        std::vector<TraceEvent> trace;
+        int threadId;
+
+        ThreadData();
+        ~ThreadData();
+    };
+
+    struct Snapshot
+    {
+        uint64_t counters[COUNTER_COUNT] = {};
+        uint64_t buckets[HISTOGRAM_COUNT][BUCKETS] = {};
+        uint64_t sums[HISTOGRAM_COUNT] = {};
+        std::vector<std::pair<int, TraceEvent>> trace;
+
+        void merge(const ThreadData &data, bool withTrace);
+    };
+
+    static void add(std::atomic<uint64_t> &slot, uint64_t n)
+    {
+        slot.store(slot.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    static int bucketIndex(int64_t value)
+    {
+        uint64_t v = value < 0 ? 0 : value;
+        if (v < SUB_BUCKETS)
+            return int(v);
+
+        int exponent = 0;
+        for (int shift = 32; shift > 0; shift /= 2)
+        {
+            if (v >> (exponent + shift))
+                exponent += shift;
+        }
+        int index = (exponent - 2) * SUB_BUCKETS + int((v >> (exponent - 3)) & (SUB_BUCKETS - 1));
+        return index < BUCKETS ? index : BUCKETS - 1;
+    }
+
+    static uint64_t bucketUpperBound(int index);
+
+    static ThreadData &local()
+    {
+        thread_local ThreadData data;
+        return data;
+    }
+
+    static std::vector<ThreadData *> &liveThreads();
+    static Snapshot &retired();
+    static Snapshot collect(bool withTrace);
+};
+
+#define METRIC_CONCAT_(a, b) a##b
+#define METRIC_CONCAT(a, b) METRIC_CONCAT_(a, b)
+#define METRIC_COUNT(counter, n) Metrics::count(Metrics::counter, n)
+#define METRIC_SCOPE(histogram) Metrics::ScopedTimer METRIC_CONCAT(metricTimer, __LINE__)(Metrics::histogram)
+#else
+#define METRIC_COUNT(counter, n) ((void)0)
+#define METRIC_SCOPE(histogram)
+#endif
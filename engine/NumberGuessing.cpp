@@ -0,0 +1,159 @@
+#include "NumberGuessing.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <memory_resource>
+#include <vector>
+
+#include "Console.h"
+#include "Metrics.h"
+
+using namespace std;
+
+void NumberGuessing::generateNumber()
+{
+    secretNumber = rand() % maxNumber + 1;
+}
+
+void NumberGuessing::play(ScoreManager &scoreManager)
+{
+    clearScreen();
+
+    cout << "\n"
+         << rule('=', 50) << "\n";
+    cout << "          NUMBER GUESSING GAME\n";
+    cout << rule('=', 50) << "\n\n";
+
+    cout << "Enter your name: ";
+    readInput(playerName);
+
+    cout << "\nDifficulty:\n";
+    cout << "1. Easy   (1-50,  10 attempts, 1x multiplier)\n";
+    cout << "2. Medium (1-100, 10 attempts, 2x multiplier)\n";
+    cout << "3. Hard   (1-200, 5 attempts,  3x multiplier)\n";
+    cout << "4. Expert (1-500, 10 attempts, 5x multiplier)\n";
+    cout << "Select difficulty: ";
+    readInput(difficulty);
+    while (difficulty < 1 || difficulty > 4)
+    {
+        cout << "Invalid input! Select difficulty: ";
+        readInput(difficulty);
+    }
+
+    switch (difficulty)
+    {
+    case 1:
+        maxNumber = 50;
+        maxAttempts = 10;
+        break;
+    case 2:
+        maxNumber = 100;
+        maxAttempts = 10;
+        break;
+    case 3:
+        maxNumber = 200;
+        maxAttempts = 5;
+        break;
+    case 4:
+        maxNumber = 500;
+        maxAttempts = 10;
+        break;
+    }
+
+    generateNumber();
+
+    cout << "\nThe computer has chosen a number between 1 and " << maxNumber << ".\n";
+    cout << "You have " << maxAttempts << " attempts to guess it!\n\n";
+
+    // Per-session arena: guesses are bump-allocated from the stack and released when play returns
+    int sessionBuffer[64];
+    pmr::monotonic_buffer_resource session(sessionBuffer, sizeof(sessionBuffer));
+    pmr::vector<int> guessHistory(&session);
+    guessHistory.reserve(maxAttempts);
+
+    int attempts = 0;
+    bool won = false;
+
+    while (attempts < maxAttempts && !won)
+    {
+        attempts++;
+
+        cout << "\n[Attempt " << attempts << "/" << maxAttempts << "] Enter your guess: ";
+        int guess;
+        readInput(guess);
+        while (guess < 1 || guess > maxNumber)
+        {
+            cout << "Invalid input! Enter your guess: ";
+            readInput(guess);
+        }
+
+        guessHistory.push_back(guess);
+
+        // The screen is never cleared here, so a frame is the reply to one guess
+        METRIC_SCOPE(FRAME_RENDER_TIME);
+        if (guess == secretNumber)
+        {
+            won = true;
+            cout << "\n*** CORRECT! ***\n";
+        }
+        else
+        {
+            if (!won)
+            {
+                if (guess > secretNumber)
+                {
+                    cout << "Try LOWER!\n";
+                }
+                else
+                {
+                    cout << "Try HIGHER!\n";
+                }
+            }
+            cout << "Attempts remaining: " << (maxAttempts - attempts) << "\n";
+        }
+    }
+    {
+        METRIC_SCOPE(FRAME_RENDER_TIME);
+        cout << "\n"
+             << rule('=', 50) << "\n";
+        cout << "              GAME OVER!\n";
+        cout << rule('=', 50) << "\n";
+
+        cout << "\nThe number was: " << secretNumber << "\n";
+        cout << "Your guesses: ";
+        for (int i = 0; i < guessHistory.size(); i++)
+        {
+            cout << guessHistory[i];
+            if (i < guessHistory.size() - 1)
+                cout << " -> ";
+        }
+
+        cout << "\n";
+    }
+
+    if (won)
+    {
+        int baseScore = 100;
+        int attemptBonus = (maxAttempts - attempts) * 20;
+        int diffMultiplier = difficulty;
+        int totalScore = (baseScore + attemptBonus) * diffMultiplier;
+
+        cout << "\nCongratulations " << playerName << "! You found it in " << attempts << " attempt(s)!\n\n";
+        cout << "Score breakdown:\n";
+        cout << "  Base points: " << baseScore << "\n";
+        cout << "  Attempt bonus: " << attemptBonus << " (" << (maxAttempts - attempts) << " attempts saved)\n";
+        cout << "  Difficulty multiplier: " << diffMultiplier << "x\n";
+        cout << "Total: " << totalScore << " points!\n";
+
+        scoreManager.saveScore("NumberGuessing", playerName, totalScore, 1);
+    }
+    else
+    {
+        cout << "\nSorry " << playerName << ", you couldn't guess the number.\n";
+        cout << "Score: 0 points\n";
+        scoreManager.saveScore("NumberGuessing", playerName, 0, 0);
+    }
+    cout << "\nPress Enter to continue...";
+    cin.ignore();
+    cin.get();
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+
+#include "ScoreManager.h"
+
+class NumberGuessing
+{
+private:
+    int secretNumber;
+    std::string playerName;
+    int maxAttempts;
+    int difficulty;
+    int maxNumber;
+
+    void generateNumber();
+
+public:
+    void play(ScoreManager &scoreManager);
+};
@@ -0,0 +1,12 @@
+#include "PlayerScore.h"
+
+bool compScores(const PlayerScore &a, const PlayerScore &b)
+{
+    if (a.score > b.score)
+        return true;
+    if (a.score < b.score)
+        return false;
+    if (a.wins > b.wins)
+        return true;
+    return false;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+struct PlayerScore
+{
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    std::pmr::string name;
+    int score;
+    int gamesPlayed;
+    int wins;
+
+    PlayerScore(std::string_view n = "", int s = 0, int gp = 1, int w = 0, const allocator_type &alloc = {}) : name(n, alloc), score(s), gamesPlayed(gp), wins(w) {}
+    PlayerScore(const PlayerScore &other, const allocator_type &alloc) : name(other.name, alloc), score(other.score), gamesPlayed(other.gamesPlayed), wins(other.wins) {}
+    PlayerScore(PlayerScore &&other, const allocator_type &alloc) : name(std::move(other.name), alloc), score(other.score), gamesPlayed(other.gamesPlayed), wins(other.wins) {}
+    PlayerScore(const PlayerScore &) = default;
+    PlayerScore(PlayerScore &&) = default;
+    PlayerScore &operator=(const PlayerScore &) = default;
+    PlayerScore &operator=(PlayerScore &&) = default;
+};
+
+bool compScores(const PlayerScore &a, const PlayerScore &b);
+
+// Player name -> position of that player's entry
+using NameIndex = std::pmr::unordered_map<std::pmr::string, int>;
+
+// Entry position for the name, or -1. The lookup key is built on the stack
+// rather than the heap, so a lookup never allocates.
+inline int findByName(const NameIndex &index, std::string_view name)
+{
+    char keyBuffer[128];
+    std::pmr::monotonic_buffer_resource keyArena(keyBuffer, sizeof(keyBuffer));
+    auto found = index.find(std::pmr::string(name, &keyArena));
+    return (found == index.end()) ? -1 : found->second;
+}
@@ -0,0 +1,223 @@
+#include "ProfileManager.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+
+using namespace std;
+
+ProfileManager::Profile::Profile(const Profile &other, const allocator_type &alloc) : segments(other.segments, alloc)
+{
+    copy(other.totals, other.totals + GAME_COUNT, totals);
+}
+
+ProfileManager::Profile::Profile(Profile &&other, const allocator_type &alloc) : segments(move(other.segments), alloc)
+{
+    copy(other.totals, other.totals + GAME_COUNT, totals);
+}
+
+int ProfileManager::gameIndex(string_view gameName)
+{
+    if (gameName == "TicTacToe")
+        return 0;
+    if (gameName == "NumberGuessing")
+        return 1;
+    return 2;
+}
+
+void ProfileManager::recordMatch(string_view playerName, string_view gameName, int score, bool won, int64_t time)
+{
+    Profile &profile = getProfile(playerName);
+
+    // statsBetween binary-searches the segments by time, so appends never go back
+    if (!profile.segments.empty())
+        time = max(time, profile.segments.back().lastTime);
+    Match match{time, gameIndex(gameName), score, won};
+    profile.totals[match.game].add(match);
+
+    // localtime is only needed when the match may open a new segment
+    bool fits = !profile.segments.empty();
+    if (fits)
+    {
+        const Segment &last = profile.segments.back();
+        fits = last.count < SEGMENT_CAPACITY && time >= last.monthStart && time < last.monthEnd;
+    }
+    if (!fits)
+    {
+        profile.segments.emplace_back();
+        Segment &segment = profile.segments.back();
+        monthBounds(time, segment);
+        segment.firstTime = time;
+        segment.lastTime = time;
+        if (profile.segments.size() > 1)
+            segment.cumulative = profile.segments[profile.segments.size() - 2].cumulative;
+    }
+
+    Segment &segment = profile.segments.back();
+    writeVarint(segment.bytes, zigzag(time - segment.lastTime));
+    segment.bytes.push_back(static_cast<unsigned char>(match.game | (won ? 4 : 0)));
+    writeVarint(segment.bytes, zigzag(score));
+    segment.lastTime = time;
+    segment.count++;
+    segment.cumulative.add(match);
+}
+
+bool ProfileManager::hasProfile(string_view playerName) const
+{
+    return findByName(index, playerName) != -1;
+}
+
+ProfileManager::Stats ProfileManager::totals(string_view playerName, int game) const
+{
+    const Profile *profile = findProfile(playerName);
+    return profile ? profile->totals[game] : Stats();
+}
+
+vector<ProfileManager::Match> ProfileManager::lastGames(string_view playerName, int count) const
+{
+    vector<Match> result;
+    const Profile *profile = findProfile(playerName);
+    if (!profile)
+        return result;
+
+    vector<Match> decoded;
+    for (int s = int(profile->segments.size()) - 1; s >= 0 && (int)result.size() < count; s--)
+    {
+        decode(profile->segments[s], decoded);
+        for (int i = int(decoded.size()) - 1; i >= 0 && (int)result.size() < count; i--)
+            result.push_back(decoded[i]);
+    }
+    return result;
+}
+
+ProfileManager::Stats ProfileManager::statsBetween(string_view playerName, int64_t from, int64_t to) const
+{
+    Stats stats;
+    const Profile *profile = findProfile(playerName);
+    if (!profile || from > to)
+        return stats;
+
+    const pmr::vector<Segment> &segments = profile->segments;
+    auto endsBefore = [](const Segment &segment, int64_t t)
+    {
+        return segment.lastTime < t;
+    };
+    auto startsAfter = [](int64_t t, const Segment &segment)
+    {
+        return t < segment.firstTime;
+    };
+    int first = lower_bound(segments.begin(), segments.end(), from, endsBefore) - segments.begin();
+    int last = int(upper_bound(segments.begin(), segments.end(), to, startsAfter) - segments.begin()) - 1;
+    if (first > last)
+        return stats;
+
+    addRange(segments[first], from, to, stats);
+    if (last != first)
+        addRange(segments[last], from, to, stats);
+
+    // Everything strictly between the boundary segments comes from the running totals
+    if (last - first > 1)
+    {
+        stats.games += segments[last - 1].cumulative.games - segments[first].cumulative.games;
+        stats.wins += segments[last - 1].cumulative.wins - segments[first].cumulative.wins;
+        stats.score += segments[last - 1].cumulative.score - segments[first].cumulative.score;
+    }
+    return stats;
+}
+
+void ProfileManager::monthBounds(int64_t time, Segment &segment)
+{
+    time_t t = static_cast<time_t>(time);
+    tm *date = localtime(&t);
+    if (!date)
+    {
+        segment.monthStart = INT64_MIN;
+        segment.monthEnd = INT64_MAX;
+        return;
+    }
+
+    tm start = *date;
+    start.tm_mday = 1;
+    start.tm_hour = 0;
+    start.tm_min = 0;
+    start.tm_sec = 0;
+    start.tm_isdst = -1;
+    tm end = start;
+    end.tm_mon++;
+    segment.monthStart = mktime(&start);
+    segment.monthEnd = mktime(&end);
+}
+
+uint64_t ProfileManager::zigzag(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t ProfileManager::unzigzag(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+void ProfileManager::writeVarint(pmr::vector<unsigned char> &bytes, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        bytes.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back(static_cast<unsigned char>(value));
+}
+
+uint64_t ProfileManager::readVarint(const unsigned char *&p)
+{
+    uint64_t value = 0;
+    for (int shift = 0;; shift += 7)
+    {
+        unsigned char byte = *p++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return value;
+    }
+}
+
+void ProfileManager::decode(const Segment &segment, vector<Match> &matches)
+{
+    matches.clear();
+    const unsigned char *p = segment.bytes.data();
+    int64_t time = segment.firstTime;
+    for (int i = 0; i < segment.count; i++)
+    {
+        time += unzigzag(readVarint(p));
+        unsigned char flags = *p++;
+        int score = static_cast<int>(unzigzag(readVarint(p)));
+        matches.push_back(Match{time, flags & 3, score, (flags & 4) != 0});
+    }
+}
+
+void ProfileManager::addRange(const Segment &segment, int64_t from, int64_t to, Stats &stats)
+{
+    vector<Match> matches;
+    decode(segment, matches);
+    for (const Match &match : matches)
+    {
+        if (match.time >= from && match.time <= to)
+            stats.add(match);
+    }
+}
+
+ProfileManager::Profile &ProfileManager::getProfile(string_view playerName)
+{
+    int found = findByName(index, playerName);
+    if (found != -1)
+        return profiles[found];
+
+    index.emplace(pmr::string(playerName, &pool), int(profiles.size()));
+    profiles.emplace_back();
+    return profiles.back();
+}
+
+const ProfileManager::Profile *ProfileManager::findProfile(string_view playerName) const
+{
+    int found = findByName(index, playerName);
+    return (found == -1) ? nullptr : &profiles[found];
+}
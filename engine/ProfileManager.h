@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "PlayerScore.h"
+
+// Append-only match history for every player. Each player's matches are kept
+// in segments that never span a calendar month and hold at most
+// SEGMENT_CAPACITY matches, stored delta/varint-encoded. Every segment also
+// carries running totals, so:
+//   - the last N games decode only the newest segments,
+//   - stats over a date range decode at most the two boundary segments,
+//   - cross-game totals are kept up to date on every append.
+class ProfileManager
+{
+public:
+    static const int GAME_COUNT = 3;
+
+    struct Match
+    {
+        int64_t time;
+        int game;
+        int score;
+        bool won;
+    };
+
+    struct Stats
+    {
+        long long games = 0;
+        long long wins = 0;
+        long long score = 0;
+
+        void add(const Match &match)
+        {
+            games++;
+            wins += match.won ? 1 : 0;
+            score += match.score;
+        }
+    };
+
+    static int gameIndex(std::string_view gameName);
+
+    // History is kept in time order: a match stamped before the player's
+    // previous one (the clock was set back) is recorded at the previous time.
+    void recordMatch(std::string_view playerName, std::string_view gameName, int score, bool won, int64_t time);
+    bool hasProfile(std::string_view playerName) const;
+    Stats totals(std::string_view playerName, int game) const;
+
+    // Most recent first
+    std::vector<Match> lastGames(std::string_view playerName, int count) const;
+
+    // All matches with from <= time <= to
+    Stats statsBetween(std::string_view playerName, int64_t from, int64_t to) const;
+
+private:
+    static const int SEGMENT_CAPACITY = 256;
+
+    struct Segment
+    {
+        using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+        int64_t monthStart = 0; // the month spans [monthStart, monthEnd) in local time
+        int64_t monthEnd = 0;
+        int count = 0;
+        int64_t firstTime = 0;
+        int64_t lastTime = 0;
+        Stats cumulative; // totals of this and every earlier segment
+        std::pmr::vector<unsigned char> bytes;
+
+        Segment(const allocator_type &alloc = {}) : bytes(alloc) {}
+        Segment(const Segment &other, const allocator_type &alloc) : monthStart(other.monthStart), monthEnd(other.monthEnd), count(other.count), firstTime(other.firstTime), lastTime(other.lastTime), cumulative(other.cumulative), bytes(other.bytes, alloc) {}
+        Segment(Segment &&other, const allocator_type &alloc) : monthStart(other.monthStart), monthEnd(other.monthEnd), count(other.count), firstTime(other.firstTime), lastTime(other.lastTime), cumulative(other.cumulative), bytes(std::move(other.bytes), alloc) {}
+        Segment(const Segment &) = default;
+        Segment(Segment &&) = default;
+        Segment &operator=(const Segment &) = default;
+        Segment &operator=(Segment &&) = default;
+    };
+
+    struct Profile
+    {
+        using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+        Stats totals[GAME_COUNT];
+        std::pmr::vector<Segment> segments;
+
+        Profile(const allocator_type &alloc = {}) : segments(alloc) {}
+        Profile(const Profile &other, const allocator_type &alloc);
+        Profile(Profile &&other, const allocator_type &alloc);
+        Profile(const Profile &) = default;
+        Profile(Profile &&) = default;
+        Profile &operator=(const Profile &) = default;
+        Profile &operator=(Profile &&) = default;
+    };
+
+    std::pmr::unsynchronized_pool_resource pool;
+    std::pmr::vector<Profile> profiles{&pool};
+    NameIndex index{&pool};
+
+    static void monthBounds(int64_t time, Segment &segment);
+    static uint64_t zigzag(int64_t value);
+    static int64_t unzigzag(uint64_t value);
+    static void writeVarint(std::pmr::vector<unsigned char> &bytes, uint64_t value);
+    static uint64_t readVarint(const unsigned char *&p);
+    static void decode(const Segment &segment, std::vector<Match> &matches);
+    static void addRange(const Segment &segment, int64_t from, int64_t to, Stats &stats);
+
+    Profile &getProfile(std::string_view playerName);
+    const Profile *findProfile(std::string_view playerName) const;
+};
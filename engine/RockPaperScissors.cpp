@@ -0,0 +1,187 @@
+#include "RockPaperScissors.h"
+
+#include <cstdlib>
+#include <iostream>
+
+#include "Console.h"
+#include "Metrics.h"
+
+using namespace std;
+
+int RockPaperScissors::determineWinner(int playerChoice, int computerChoice)
+{
+    if (playerChoice == computerChoice)
+        return 0; // Draw
+
+    if ((playerChoice == 0 && computerChoice == 2) ||
+        (playerChoice == 1 && computerChoice == 0) ||
+        (playerChoice == 2 && computerChoice == 1))
+    {
+        return 1; // Player wins
+    }
+
+    return -1; // Computer wins
+}
+
+string RockPaperScissors::choiceToString(int choice)
+{
+    switch (choice)
+    {
+    case ROCK:
+        return "Rock";
+    case PAPER:
+        return "Paper";
+    case SCISSORS:
+        return "Scissors";
+    default:
+        return "";
+    }
+}
+
+const char *RockPaperScissors::getWinDescription(int winner)
+{
+
+    if (winner == ROCK)
+        return "Rock crushes Scissors!";
+    if (winner == PAPER)
+        return "Paper covers Rock!";
+    if (winner == SCISSORS)
+        return "Scissors cuts Paper!";
+    else
+        return "";
+}
+
+void RockPaperScissors::play(ScoreManager &scoreManager)
+{
+    clearScreen();
+    cout << "\n"
+         << rule('=', 50) << "\n";
+    cout << "         ROCK PAPER SCISSORS\n";
+    cout << rule('=', 50) << "\n\n";
+
+    cout << "Enter your name: ";
+    readInput(playerName);
+
+    cout << "\nWin Target:\n";
+    cout << "1. First to 3 (Quick match)\n";
+    cout << "2. First to 5 (Standard match)\n";
+    cout << "3. First to 10 (Extended match)\n";
+    cout << "Select target: ";
+    int targetChoice;
+    readInput(targetChoice);
+    while (targetChoice < 1 || targetChoice > 3)
+    {
+        cout << "Invalid input! Select target: ";
+        readInput(targetChoice);
+    }
+
+    int winTarget;
+
+    switch (targetChoice)
+    {
+    case 1:
+        winTarget = 3;
+        break;
+    case 2:
+        winTarget = 5;
+        break;
+    case 3:
+        winTarget = 10;
+        break;
+    }
+
+    int round = 0;
+    while (playerScore < winTarget && computerScore < winTarget)
+    {
+        round++;
+        clearScreen();
+        {
+            METRIC_SCOPE(FRAME_RENDER_TIME);
+            cout << "\n"
+                 << rule('=', 50) << "\n";
+            cout << "         ROCK PAPER SCISSORS\n";
+            cout << rule('=', 50) << "\n";
+
+            cout << "\n--- Current Score ---\n";
+            cout << playerName << ": " << playerScore << " | Computer: " << computerScore << "\n";
+
+            cout << "\nChoices:\n";
+            cout << "1. Rock\n2. Paper\n3. Scissors\n";
+            cout << "Your choice: ";
+        }
+        int playerChoice;
+        readInput(playerChoice);
+        while (playerChoice < 1 || playerChoice > 3)
+        {
+            cout << "Invalid input! Your choice: ";
+            readInput(playerChoice);
+        }
+
+        int computerChoice = (rand() % 3) + 1;
+
+        cout << "\n"
+             << playerName << " chose: " << choiceToString(playerChoice) << "\n";
+        sleepMs(500);
+        cout << "Computer chose: " << choiceToString(computerChoice) << "\n";
+
+        int result = determineWinner(playerChoice - 1, computerChoice - 1);
+
+        if (result == 1)
+        {
+            cout << getWinDescription(playerChoice) << "\n";
+            cout << "\n*** " << playerName << " WINS THIS ROUND! ***\n";
+            playerScore++;
+        }
+        else if (result == -1)
+        {
+            cout << "\n*** COMPUTER WINS THIS ROUND! ***\n";
+            computerScore++;
+        }
+        else
+        {
+            cout << "\n*** IT'S A DRAW! ***\n";
+        }
+
+        sleepMs(1500);
+    }
+
+    clearScreen();
+    {
+        METRIC_SCOPE(FRAME_RENDER_TIME);
+        cout << "\n"
+             << rule('=', 50) << "\n";
+        cout << "              GAME OVER!\n";
+        cout << rule('=', 50) << "\n";
+
+        cout << "\nFinal Score: " << playerName << " " << playerScore
+             << " - " << computerScore << " Computer\n";
+    }
+
+    if (playerScore > computerScore)
+    {
+        cout << "\n*** Congratulations " << playerName << "! You WON! ***\n\n";
+
+        int totalScore = playerScore * 20;
+
+        cout << "  Score: " << totalScore << " points!\n";
+
+        scoreManager.saveScore("RockPaperScissors", playerName, totalScore, 1);
+    }
+    else if (computerScore > playerScore)
+    {
+        cout << "\n*** Sorry " << playerName << ", you LOST. Better luck next time! ***\n\n";
+        cout << "Score: 0 points\n";
+        scoreManager.saveScore("RockPaperScissors", playerName, 0, 0);
+    }
+    else
+    {
+        cout << "\n*** It's a DRAW! ***\n\n";
+        int consolation = playerScore * 5;
+        cout << "Consolation points: " << consolation << "\n";
+        scoreManager.saveScore("RockPaperScissors", playerName, consolation, 0);
+    }
+
+    cout << "\nPress Enter to continue...";
+    cin.ignore();
+    cin.get();
+}
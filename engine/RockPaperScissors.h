@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+
+#include "ScoreManager.h"
+
+class RockPaperScissors
+{
+private:
+    std::string playerName;
+    int playerScore = 0;
+    int computerScore = 0;
+
+    enum Choice
+    {
+        ROCK = 1,
+        PAPER,
+        SCISSORS
+    };
+
+    int determineWinner(int playerChoice, int computerChoice);
+
+    std::string choiceToString(int choice);
+
+    const char *getWinDescription(int winner);
+
+public:
+    void play(ScoreManager &scoreManager);
+};
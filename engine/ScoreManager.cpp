@@ -0,0 +1,186 @@
+#include "ScoreManager.h"
+
+#include <algorithm>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+
+#include "Console.h"
+#include "Metrics.h"
+
+using namespace std;
+
+Leaderboard &ScoreManager::getLeaderboard(string_view gameName)
+{
+    if (gameName == "TicTacToe")
+        return tttScores;
+    if (gameName == "NumberGuessing")
+        return ngScores;
+    return rpsScores;
+}
+
+void ScoreManager::browseScores(const string &title, const Leaderboard &scores)
+{
+    int firstRank = 0;
+    string command;
+
+    while (true)
+    {
+        {
+            clearScreen();
+            METRIC_SCOPE(FRAME_RENDER_TIME);
+            scores.displayPage(title, firstRank, PAGE_SIZE);
+            cout << "\nn = next page, p = previous page, f = find player, q = back: ";
+        }
+        readInput(command);
+
+        if (command == "n" && firstRank + PAGE_SIZE < scores.size())
+        {
+            firstRank += PAGE_SIZE;
+        }
+        else if (command == "p")
+        {
+            firstRank = max(0, firstRank - PAGE_SIZE);
+        }
+        else if (command == "f")
+        {
+            cout << "Player name: ";
+            string playerName;
+            readInput(playerName);
+            int rank = scores.rankOfPlayer(playerName);
+            if (rank == -1)
+            {
+                cout << playerName << " has no score yet.\n";
+                sleepMs(1500);
+            }
+            else
+            {
+                // Centre the page on the player
+                firstRank = max(0, rank - PAGE_SIZE / 2);
+            }
+        }
+        else if (command == "q")
+        {
+            return;
+        }
+    }
+}
+
+void ScoreManager::saveScore(string_view gameName, string_view playerName, int score, int wins)
+{
+    METRIC_SCOPE(SAVE_SCORE_TIME);
+    getLeaderboard(gameName).add(playerName, score, wins);
+    profiles.recordMatch(playerName, gameName, score, wins > 0, time(0));
+}
+
+void ScoreManager::showPlayerProfile()
+{
+    static const char *gameTitles[ProfileManager::GAME_COUNT] = {"Tic-Tac-Toe", "Number Guessing", "Rock Paper Scissors"};
+
+    clearScreen();
+    cout << "\nEnter player name: ";
+    string playerName;
+    readInput(playerName);
+
+    clearScreen();
+    {
+        METRIC_SCOPE(FRAME_RENDER_TIME);
+        cout << "\n"
+             << rule('=', 60) << "\n";
+        cout << "  PLAYER PROFILE: " << playerName << "\n";
+        cout << rule('=', 60) << "\n";
+
+        if (!profiles.hasProfile(playerName))
+        {
+            cout << "\nNo games recorded for " << playerName << " yet.\n";
+        }
+        else
+        {
+            cout << "\n"
+                 << left << setw(24) << "Game" << setw(10) << "Games" << setw(10) << "Wins" << "Score\n";
+            cout << rule('-', 56) << "\n";
+            ProfileManager::Stats overall;
+            for (int game = 0; game < ProfileManager::GAME_COUNT; game++)
+            {
+                ProfileManager::Stats stats = profiles.totals(playerName, game);
+                cout << setw(24) << gameTitles[game] << setw(10) << stats.games << setw(10) << stats.wins << stats.score << "\n";
+                overall.games += stats.games;
+                overall.wins += stats.wins;
+                overall.score += stats.score;
+            }
+            cout << rule('-', 56) << "\n";
+            cout << setw(24) << "All games" << setw(10) << overall.games << setw(10) << overall.wins << overall.score << "\n";
+
+            int64_t now = time(0);
+            const int periods[2] = {7, 30};
+            cout << "\n";
+            for (int days : periods)
+            {
+                ProfileManager::Stats recent = profiles.statsBetween(playerName, now - days * 86400LL, now);
+                cout << "Last " << setw(2) << days << " days: " << recent.games << " games, " << recent.wins << " wins, " << recent.score << " points\n";
+            }
+
+            cout << "\nRecent games:\n";
+            for (const ProfileManager::Match &match : profiles.lastGames(playerName, 10))
+            {
+                time_t t = static_cast<time_t>(match.time);
+                char when[32] = "";
+                if (tm *date = localtime(&t))
+                    strftime(when, sizeof(when), "%Y-%m-%d %H:%M", date);
+                cout << "  " << setw(18) << when << setw(22) << gameTitles[match.game] << setw(8) << match.score << (match.won ? "WIN" : "-") << "\n";
+            }
+        }
+    }
+
+    cout << "\nPress Enter to return to menu...";
+    cin.ignore();
+    cin.get();
+}
+
+void ScoreManager::showAllHighScores()
+{
+    int choice = -1;
+    while (choice != 0)
+    {
+        {
+            clearScreen();
+            METRIC_SCOPE(FRAME_RENDER_TIME);
+            cout << "\n"
+                 << rule('=', 60) << "\n";
+            cout << "                    HIGH SCORES\n";
+            cout << rule('=', 60) << "\n";
+
+            tttScores.displayPage("TIC-TAC-TOE GAME", 0, PAGE_SIZE);
+            ngScores.displayPage("NUMBER GUESSING GAME", 0, PAGE_SIZE);
+            rpsScores.displayPage("ROCK PAPER SCISSORS", 0, PAGE_SIZE);
+
+            cout << "\nBrowse a full table (1. Tic-Tac-Toe, 2. Number Guessing, 3. Rock Paper Scissors) or 0 to return: ";
+        }
+        readInput(choice);
+
+        switch (choice)
+        {
+        case 1:
+            browseScores("TIC-TAC-TOE GAME", tttScores);
+            break;
+        case 2:
+            browseScores("NUMBER GUESSING GAME", ngScores);
+            break;
+        case 3:
+            browseScores("ROCK PAPER SCISSORS", rpsScores);
+            break;
+        }
+    }
+}
+
+void ScoreManager::resetAllScores()
+{
+    tttScores.clear();
+    ngScores.clear();
+    rpsScores.clear();
+
+    cout << "\nAll High Scores have been reset!\n";
+    cout << "Press Enter to return to menu...\n";
+    cin.ignore();
+    cin.get();
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory_resource>
+#include <string>
+#include <string_view>
+
+#include "Leaderboard.h"
+#include "ProfileManager.h"
+
+class ScoreManager
+{
+private:
+    static const int PAGE_SIZE = 10;
+
+    // All leaderboard rows and names live in one pool owned by the manager
+    std::pmr::unsynchronized_pool_resource pool;
+    Leaderboard tttScores{&pool};
+    Leaderboard ngScores{&pool};
+    Leaderboard rpsScores{&pool};
+    ProfileManager profiles;
+
+    Leaderboard &getLeaderboard(std::string_view gameName);
+    void browseScores(const std::string &title, const Leaderboard &scores);
+
+public:
+    void saveScore(std::string_view gameName, std::string_view playerName, int score, int wins = 1);
+    void showPlayerProfile();
+    void showAllHighScores();
+    void resetAllScores();
+};
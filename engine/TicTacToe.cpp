@@ -0,0 +1,375 @@
+#include "TicTacToe.h"
+
+#include <algorithm>
+#include <iostream>
+#include <memory_resource>
+#include <vector>
+
+#include "BoardBatch.h"
+#include "Console.h"
+#include "Metrics.h"
+
+using namespace std;
+
+void TicTacToe::initialBoard()
+{
+    for (int i = 0; i < 9; i++)
+        board[i] = ' ';
+}
+
+void TicTacToe::displayBoard() const
+{
+    cout << "\n";
+    for (int i = 0; i < 9; i++)
+    {
+        if (i % 3 == 0 && i != 0)
+        {
+            cout << "\n-----|-----|-----\n";
+        }
+
+        if (board[i] == 'X')
+        {
+            cout << "  X  ";
+        }
+        else if (board[i] == 'O')
+        {
+            cout << "  O  ";
+        }
+        else
+        {
+            cout << "  " << (i + 1) << "  ";
+        }
+
+        if ((i + 1) % 3 != 0)
+            cout << "|";
+    }
+    cout << "\n\n";
+}
+
+bool TicTacToe::checkWin(char mark) const
+{
+    // Rows
+    for (int i = 0; i < 9; i += 3)
+    {
+        if (board[i] == mark && board[i + 1] == mark && board[i + 2] == mark)
+            return true;
+    }
+
+    // Columns
+    for (int i = 0; i < 3; i++)
+    {
+        if (board[i] == mark && board[i + 3] == mark && board[i + 6] == mark)
+            return true;
+    }
+
+    // Diagonals
+    if (board[0] == mark && board[4] == mark && board[8] == mark)
+        return true;
+    if (board[2] == mark && board[4] == mark && board[6] == mark)
+        return true;
+
+    return false;
+}
+
+bool TicTacToe::isBoardFull() const
+{
+    for (int i = 0; i < 9; i++)
+    {
+        if (board[i] == ' ')
+            return false;
+    }
+    return true;
+}
+
+int TicTacToe::terminalScore(unsigned char status, int depth) const
+{
+    unsigned char computerWins = (computerMark == 'O') ? BoardBatch::O_WINS : BoardBatch::X_WINS;
+    if (status == BoardBatch::DRAW)
+        return 0;
+    if (status == computerWins)
+        return 10 - depth;
+    return depth - 10;
+}
+
+int TicTacToe::expandChildren(char mark, int cells[9], unsigned char status[9]) const
+{
+    uint16_t xMask = BoardBatch::toMask(board, 'X');
+    uint16_t oMask = BoardBatch::toMask(board, 'O');
+    uint16_t empty = ~(xMask | oMask) & BoardBatch::FULL_BOARD;
+
+    uint16_t childX[9];
+    uint16_t childO[9];
+    int count = 0;
+    for (int i = 0; i < 9; i++)
+    {
+        if (empty & (1 << i))
+        {
+            cells[count] = i;
+            childX[count] = xMask | (mark == 'X' ? 1 << i : 0);
+            childO[count] = oMask | (mark == 'O' ? 1 << i : 0);
+            count++;
+        }
+    }
+    BoardBatch::evaluate(childX, childO, count, status);
+    return count;
+}
+
+int TicTacToe::minimax(bool isMaximizing, int depth)
+{
+    METRIC_COUNT(MINIMAX_NODES, 1);
+    char humanMark = (computerMark == 'O') ? 'X' : 'O';
+    char mark = isMaximizing ? computerMark : humanMark;
+    int cells[9];
+    unsigned char status[9];
+    int count = expandChildren(mark, cells, status);
+
+    int bestScore = isMaximizing ? -1000 : 1000;
+    for (int k = 0; k < count; k++)
+    {
+        int score;
+        if (status[k] != BoardBatch::ONGOING)
+        {
+            score = terminalScore(status[k], depth + 1);
+        }
+        else
+        {
+            board[cells[k]] = mark;
+            score = minimax(!isMaximizing, depth + 1);
+            board[cells[k]] = ' ';
+        }
+        bestScore = isMaximizing ? max(bestScore, score) : min(bestScore, score);
+    }
+    return bestScore;
+}
+
+int TicTacToe::getComputerMove()
+{
+    METRIC_SCOPE(AI_MOVE_TIME);
+    METRIC_COUNT(AI_MOVES, 1);
+
+    if (engine == RANDOM_ENGINE)
+    {
+        // Per-move arena: the spot list never leaves this stack buffer
+        int arenaBuffer[16];
+        pmr::monotonic_buffer_resource arena(arenaBuffer, sizeof(arenaBuffer));
+        pmr::vector<int> emptySpots(&arena);
+        emptySpots.reserve(9);
+        for (int i = 0; i < 9; i++)
+        {
+            if (board[i] == ' ')
+                emptySpots.push_back(i);
+        }
+        return emptySpots[rng() % emptySpots.size()];
+    }
+
+    if (engine == TABLEBASE_ENGINE && tablebase.open("tictactoe.tb"))
+    {
+        METRIC_COUNT(TABLEBASE_PROBES, 1);
+        int move = tablebase.bestMove(board);
+        if (move != -1)
+            return move;
+    }
+
+    int bestScore = -1000;
+    int bestMove = -1;
+    int cells[9];
+    unsigned char status[9];
+    int count = expandChildren(computerMark, cells, status);
+
+    for (int k = 0; k < count; k++)
+    {
+        int score;
+        if (status[k] != BoardBatch::ONGOING)
+        {
+            score = terminalScore(status[k], 0);
+        }
+        else
+        {
+            board[cells[k]] = computerMark;
+            score = minimax(false, 0);
+            board[cells[k]] = ' ';
+        }
+        if (score > bestScore)
+        {
+            bestScore = score;
+            bestMove = cells[k];
+        }
+    }
+    return bestMove;
+}
+
+int TicTacToe::chooseMove(const char position[9], char mark, Engine moveEngine)
+{
+    copy(position, position + 9, board);
+    computerMark = mark;
+    engine = moveEngine;
+    return getComputerMove();
+}
+
+void TicTacToe::seed(unsigned int value)
+{
+    rng.seed(value);
+}
+
+void TicTacToe::play(ScoreManager &scoreManager)
+{
+    clearScreen();
+    initialBoard();
+    computerMark = 'O';
+
+    cout << "\n"
+         << rule('=', 50) << "\n";
+    cout << "              TIC TAC TOE\n";
+    cout << rule('=', 50) << "\n\n";
+
+    cout << "Game Mode: \n";
+    cout << "1. Player vs Player\n";
+    cout << "2. Player vs Computer\n";
+    cout << "Select Mode: ";
+    int mode;
+    readInput(mode);
+    while (mode < 1 || mode > 2)
+    {
+        cout << "Invalid Input. Enter again: ";
+        readInput(mode);
+    }
+
+    vsComputer = (mode == 2);
+
+    if (vsComputer)
+    {
+        cout << "Enter your name (X): ";
+        readInput(player1Name);
+
+        player2Name = "Computer";
+
+        cout << "\nDifficulty: \n";
+        cout << "1. Easy (Score Multiplier: 1x)\n";
+        cout << "2. Hard (Score Multiplier: 2x)\n";
+
+        cout << "Select Difficulty: ";
+        difficulty;
+        readInput(difficulty);
+        while (difficulty < 1 || difficulty > 2)
+        {
+            cout << "Invalid Input. Enter again: ";
+            readInput(difficulty);
+        }
+        engine = (difficulty == 1) ? RANDOM_ENGINE : TABLEBASE_ENGINE;
+    }
+    else
+    {
+        cout << "Enter Player 1 (X) name: ";
+        readInput(player1Name);
+        cout << "Enter Player 2 (O) name: ";
+        readInput(player2Name);
+        difficulty = 1;
+    }
+    int currentPlayer = 0;
+    bool gameOver = false;
+    int moves = 0;
+    int winner = -1;
+
+    while (!gameOver)
+    {
+        clearScreen();
+        {
+            METRIC_SCOPE(FRAME_RENDER_TIME);
+            cout << "\n"
+                 << rule('=', 50) << "\n";
+            cout << "              TIC TAC TOE\n";
+            cout << rule('=', 50) << "\n";
+            cout << "\n"
+                 << player1Name << " (X)  vs  " << player2Name << " (O)\n";
+
+            displayBoard();
+        }
+
+        int move;
+        if (currentPlayer == 0 || !vsComputer)
+        {
+            cout << (currentPlayer == 0 ? player1Name : player2Name) << "'s turn. Enter your move (1-9): ";
+            readInput(move);
+            while (move < 1 || move > 9 || board[move - 1] != ' ')
+            {
+                cout << "Invalid move. Enter again: ";
+                readInput(move);
+            }
+        }
+        else
+        {
+            move = getComputerMove() + 1;
+            cout << "Computer chooses position " << move << ".\n";
+            sleepMs(1000);
+        }
+
+        board[move - 1] = (currentPlayer == 0) ? 'X' : 'O';
+        moves++;
+
+        if (checkWin(board[move - 1]))
+        {
+            gameOver = true;
+            winner = currentPlayer;
+        }
+        else if (isBoardFull())
+        {
+            gameOver = true;
+            winner = 2;
+        }
+        else
+        {
+            currentPlayer = 1 - currentPlayer;
+        }
+    }
+    clearScreen();
+    {
+        METRIC_SCOPE(FRAME_RENDER_TIME);
+        cout << "\n"
+             << rule('=', 50) << "\n";
+        cout << "              GAME OVER!\n";
+        cout << rule('=', 50) << "\n";
+        cout << "\n"
+             << player1Name << " (X)  vs  " << player2Name << " (O)\n";
+        displayBoard();
+    }
+
+    int drawScore = 25;
+    int winScore = 100;
+    if (winner == 2)
+    {
+        cout << "It's a DRAW!\n";
+        scoreManager.saveScore("TicTacToe", player1Name, drawScore, 0);
+        if (!vsComputer)
+        {
+            scoreManager.saveScore("TicTacToe", player2Name, drawScore, 0);
+        }
+        cout << "Both players earn " << drawScore << " points.\n";
+    }
+    else
+    {
+        const string &winnerName = (winner == 0) ? player1Name : player2Name;
+        const string &loserName = (winner == 0) ? player2Name : player1Name;
+
+        cout << "*** " << winnerName << " WINS! ***\n";
+
+        int totalScore = winScore * difficulty;
+
+        cout << "Score breakdown:\n";
+        cout << "  Base points: " << winScore << "\n";
+        if (vsComputer && winner == 0)
+        {
+            cout << "  Difficulty multiplier: " << difficulty << "x\n";
+        }
+        cout << "Total: " << totalScore << " points!\n";
+
+        scoreManager.saveScore("TicTacToe", winnerName, totalScore, 1);
+
+        if (!vsComputer)
+        {
+            scoreManager.saveScore("TicTacToe", loserName, 10, 0);
+        }
+    }
+    cout << "\nPress Enter to continue...";
+    cin.ignore();
+    cin.get();
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <random>
+#include <string>
+
+#include "ScoreManager.h"
+#include "TicTacToeTablebase.h"
+
+class TicTacToe
+{
+private:
+    char board[9];
+    std::string player1Name;
+    std::string player2Name;
+    bool vsComputer;
+    int difficulty;
+    TicTacToeTablebase tablebase;
+    std::mt19937 rng{std::random_device{}()};
+    char computerMark = 'O';
+    int engine = RANDOM_ENGINE;
+
+    void initialBoard();
+
+    void displayBoard() const;
+
+    bool checkWin(char mark) const;
+
+    bool isBoardFull() const;
+
+    int terminalScore(unsigned char status, int depth) const;
+
+    // Places mark on every empty cell and classifies all resulting positions in one batch
+    int expandChildren(char mark, int cells[9], unsigned char status[9]) const;
+
+    // Called on non-terminal positions only; terminal children are scored
+    // straight from the batch result instead of being recursed into.
+    int minimax(bool isMaximizing, int depth);
+
+    int getComputerMove();
+
+public:
+    enum Engine
+    {
+        RANDOM_ENGINE,
+        TABLEBASE_ENGINE,
+        MINIMAX_ENGINE
+    };
+
+    // Headless entry point for simulations: returns the move (0-8) engine
+    // would play for mark on position.
+    int chooseMove(const char position[9], char mark, Engine moveEngine);
+
+    void seed(unsigned int value);
+
+    void play(ScoreManager &scoreManager);
+};
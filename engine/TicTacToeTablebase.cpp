@@ -0,0 +1,265 @@
+#include "TicTacToeTablebase.h"
+
+#include <algorithm>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "BoardBatch.h"
+
+using namespace std;
+
+int TicTacToeTablebase::power3(int cell)
+{
+    int p = 1;
+    for (int i = 0; i < cell; i++)
+        p *= 3;
+    return p;
+}
+
+int TicTacToeTablebase::positionIndex(const char board[9])
+{
+    int index = 0;
+    for (int i = CELLS - 1; i >= 0; i--)
+    {
+        index *= 3;
+        if (board[i] == 'X')
+            index += 1;
+        else if (board[i] == 'O')
+            index += 2;
+    }
+    return index;
+}
+
+int TicTacToeTablebase::popCount(uint16_t mask)
+{
+    int count = 0;
+    for (; mask; mask &= mask - 1)
+        count++;
+    return count;
+}
+
+int TicTacToeTablebase::getValue(const unsigned char *packed, int index)
+{
+    return (packed[index >> 2] >> ((index & 3) * 2)) & 3;
+}
+
+void TicTacToeTablebase::setValue(vector<unsigned char> &packed, int index, int value)
+{
+    packed[index >> 2] |= value << ((index & 3) * 2);
+}
+
+void TicTacToeTablebase::closeMapping()
+{
+    if (view)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(view);
+#else
+        munmap(const_cast<void *>(view), viewSize);
+#endif
+    }
+    view = nullptr;
+    viewSize = 0;
+    table = nullptr;
+}
+
+// The view keeps the mapping alive, so the file handles are closed straight away
+bool TicTacToeTablebase::mapFile(const string &path)
+{
+    size_t expected = HEADER_BYTES + TABLE_BYTES;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    HANDLE mapping = NULL;
+    if (GetFileSizeEx(file, &size) && size.QuadPart == (LONGLONG)expected)
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping)
+    {
+        view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) == 0 && (size_t)info.st_size == expected)
+    {
+        void *mapped = mmap(nullptr, expected, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED)
+            view = mapped;
+    }
+    close(fd);
+#endif
+    if (!view)
+        return false;
+    viewSize = expected;
+
+    const unsigned char *bytes = static_cast<const unsigned char *>(view);
+    unsigned int positions = bytes[8] | (bytes[9] << 8) | (bytes[10] << 16) | (bytes[11] << 24);
+    if (string(reinterpret_cast<const char *>(bytes), 4) != "TTTB" || bytes[4] != 1 || positions != POSITIONS)
+    {
+        closeMapping();
+        return false;
+    }
+
+    table = bytes + HEADER_BYTES;
+    return true;
+}
+
+TicTacToeTablebase::~TicTacToeTablebase()
+{
+    closeMapping();
+}
+
+vector<unsigned char> TicTacToeTablebase::generate()
+{
+    vector<unsigned char> packed(TABLE_BYTES, 0);
+    vector<uint16_t> xMasks(POSITIONS);
+    vector<uint16_t> oMasks(POSITIONS);
+    vector<unsigned char> status(POSITIONS);
+    vector<uint16_t> empties(POSITIONS);
+
+    for (int index = 0; index < POSITIONS; index++)
+    {
+        int rest = index;
+        for (int i = 0; i < CELLS; i++)
+        {
+            if (rest % 3 == 1)
+                xMasks[index] |= 1 << i;
+            else if (rest % 3 == 2)
+                oMasks[index] |= 1 << i;
+            rest /= 3;
+        }
+    }
+    BoardBatch::evaluate(xMasks.data(), oMasks.data(), POSITIONS, status.data());
+    BoardBatch::legalMoves(xMasks.data(), oMasks.data(), POSITIONS, empties.data());
+
+    for (int index = POSITIONS - 1; index >= 0; index--)
+    {
+        int xCount = popCount(xMasks[index]);
+        int oCount = popCount(oMasks[index]);
+        if (xCount != oCount && xCount != oCount + 1)
+            continue;
+
+        int mover = (xCount == oCount) ? 1 : 2;
+        bool xWin = BoardBatch::evaluateOne(xMasks[index], 0) == BoardBatch::X_WINS;
+        bool oWin = BoardBatch::evaluateOne(0, oMasks[index]) == BoardBatch::O_WINS;
+
+        // Only the player who just moved may own a line
+        if ((xWin && mover == 1) || (oWin && mover == 2))
+            continue;
+
+        if (status[index] == BoardBatch::X_WINS || status[index] == BoardBatch::O_WINS)
+        {
+            setValue(packed, index, LOSS);
+            continue;
+        }
+
+        if (status[index] == BoardBatch::DRAW)
+        {
+            setValue(packed, index, DRAW);
+            continue;
+        }
+
+        int best = LOSS;
+        for (int i = 0; i < CELLS; i++)
+        {
+            if (empties[index] & (1 << i))
+            {
+                int childValue = getValue(packed.data(), index + mover * power3(i));
+                best = max(best, WIN + LOSS - childValue);
+            }
+        }
+        setValue(packed, index, best);
+    }
+    return packed;
+}
+
+bool TicTacToeTablebase::writeFile(const string &path, const vector<unsigned char> &packed)
+{
+    ofstream out(path, ios::binary | ios::trunc);
+    if (!out)
+        return false;
+
+    const unsigned char header[HEADER_BYTES] = {'T', 'T', 'T', 'B', 1, 0, 0, 0,
+                                                POSITIONS & 0xFF, (POSITIONS >> 8) & 0xFF, (POSITIONS >> 16) & 0xFF, 0};
+    out.write(reinterpret_cast<const char *>(header), HEADER_BYTES);
+    out.write(reinterpret_cast<const char *>(packed.data()), packed.size());
+    return bool(out);
+}
+
+bool TicTacToeTablebase::open(const string &path)
+{
+    if (opened)
+        return table != nullptr;
+    opened = true;
+
+    if (mapFile(path))
+        return true;
+
+    memoryTable = generate();
+    table = memoryTable.data();
+    return true;
+}
+
+int TicTacToeTablebase::bestMove(const char board[9]) const
+{
+    if (!table)
+        return -1;
+
+    int index = positionIndex(board);
+    if (getValue(table, index) == ILLEGAL)
+        return -1;
+
+    uint16_t xMask = BoardBatch::toMask(board, 'X');
+    uint16_t oMask = BoardBatch::toMask(board, 'O');
+    int mover = (popCount(xMask) == popCount(oMask)) ? 1 : 2;
+
+    uint16_t childX[9];
+    uint16_t childO[9];
+    int cells[9];
+    int count = 0;
+    for (int i = 0; i < CELLS; i++)
+    {
+        if (board[i] != ' ')
+            continue;
+        cells[count] = i;
+        childX[count] = xMask | (mover == 1 ? 1 << i : 0);
+        childO[count] = oMask | (mover == 2 ? 1 << i : 0);
+        count++;
+    }
+    unsigned char status[9];
+    BoardBatch::evaluate(childX, childO, count, status);
+
+    int bestScore = -1;
+    int move = -1;
+    for (int k = 0; k < count; k++)
+    {
+        int score = WIN + LOSS - getValue(table, index + mover * power3(cells[k]));
+
+        // Among equal outcomes, take a move that ends the game right away
+        bool ends = status[k] == BoardBatch::X_WINS || status[k] == BoardBatch::O_WINS;
+        score = score * 2 + (ends ? 1 : 0);
+
+        if (score > bestScore)
+        {
+            bestScore = score;
+            move = cells[k];
+        }
+    }
+    return move;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class TicTacToeTablebase
+{
+private:
+    static const int CELLS = 9;
+    static const int POSITIONS = 19683; // 3^9, every cell is empty, X or O
+    static const int TABLE_BYTES = (POSITIONS + 3) / 4;
+    static const int HEADER_BYTES = 12;
+
+    // 2-bit values, always from the point of view of the side to move
+    enum Value
+    {
+        ILLEGAL = 0,
+        LOSS,
+        DRAW,
+        WIN
+    };
+
+    const unsigned char *table = nullptr;
+    std::vector<unsigned char> memoryTable;
+    const void *view = nullptr;
+    size_t viewSize = 0;
+    bool opened = false;
+
+    static int power3(int cell);
+
+    // Perfect hash: the board read as a base-3 number (empty = 0, X = 1, O = 2)
+    static int positionIndex(const char board[9]);
+
+    static int popCount(uint16_t mask);
+
+    static int getValue(const unsigned char *packed, int index);
+
+    static void setValue(std::vector<unsigned char> &packed, int index, int value);
+
+    void closeMapping();
+
+    bool mapFile(const std::string &path);
+
+public:
+    ~TicTacToeTablebase();
+
+    // Retrograde analysis: placing a mark always raises the index, so sweeping
+    // from the highest index down solves every child before its parent.
+    static std::vector<unsigned char> generate();
+
+    static bool writeFile(const std::string &path, const std::vector<unsigned char> &packed);
+
+    // Maps the table file on first use. Pages are only faulted in for positions
+    // that are actually looked up. A missing or stale file is never rewritten
+    // here; the table is built in memory instead (see --build-tablebase).
+    bool open(const std::string &path);
+
+    bool isMapped() const
+    {
+        return view != nullptr;
+    }
+
+    // Best move (0-8) for whichever side is to move, or -1 if the position is not in the table
+    int bestMove(const char board[9]) const;
+};
@@ -0,0 +1,253 @@
+#include "Tournament.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#include "BoardBatch.h"
+
+using namespace std;
+
+double Tournament::eloToScore(double elo)
+{
+    return 1 / (1 + pow(10, -elo / 400));
+}
+
+double Tournament::scoreToElo(double score)
+{
+    return -400 * log10(1 / score - 1);
+}
+
+void Tournament::scoreStats(const Result &result, double &mean, double &variance, double &pairs)
+{
+    double counts[5];
+    for (int k = 0; k < 5; k++)
+        counts[k] = result.pairs[k];
+    counts[0] += 0.5;
+    counts[4] += 0.5;
+
+    pairs = 0;
+    mean = 0;
+    for (int k = 0; k < 5; k++)
+    {
+        pairs += counts[k];
+        mean += counts[k] * k / 4.0;
+    }
+    mean /= pairs;
+
+    variance = 0;
+    for (int k = 0; k < 5; k++)
+        variance += counts[k] * (k / 4.0 - mean) * (k / 4.0 - mean);
+    variance /= pairs;
+}
+
+double Tournament::logLikelihoodRatio(const Result &result) const
+{
+    double mean, variance, pairs;
+    scoreStats(result, mean, variance, pairs);
+    double s0 = eloToScore(elo0);
+    double s1 = eloToScore(elo1);
+    return pairs * (s1 - s0) * (2 * mean - s0 - s1) / (2 * variance);
+}
+
+int Tournament::randomOpening(mt19937 &rng, int opening[2])
+{
+    int plies = 1 + rng() % 2;
+    opening[0] = rng() % 9;
+    opening[1] = (opening[0] + 1 + rng() % 8) % 9;
+    return plies;
+}
+
+unsigned char Tournament::playGame(TicTacToe &ai, const int opening[2], int openingPlies, TicTacToe::Engine xEngine, TicTacToe::Engine oEngine)
+{
+    char position[9] = {' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '};
+    uint16_t masks[2] = {0, 0};
+    char mark = 'X';
+
+    // Two plies can never end a game, so the opening is played without checks
+    for (int ply = 0; ply < openingPlies; ply++)
+    {
+        position[opening[ply]] = mark;
+        masks[mark == 'X' ? 0 : 1] |= 1 << opening[ply];
+        mark = (mark == 'X') ? 'O' : 'X';
+    }
+
+    while (true)
+    {
+        int move = ai.chooseMove(position, mark, (mark == 'X') ? xEngine : oEngine);
+        position[move] = mark;
+        masks[mark == 'X' ? 0 : 1] |= 1 << move;
+
+        unsigned char status = BoardBatch::evaluateOne(masks[0], masks[1]);
+        if (status != BoardBatch::ONGOING)
+            return status;
+        mark = (mark == 'X') ? 'O' : 'X';
+    }
+}
+
+int Tournament::halfPoints(unsigned char status, bool firstPlaysX)
+{
+    if (status == BoardBatch::DRAW)
+        return 1;
+    return ((status == BoardBatch::X_WINS) == firstPlaysX) ? 2 : 0;
+}
+
+void Tournament::finish(const Pairing &pairing, const Result &result, double llr)
+{
+    double lower = log(beta / (1 - alpha));
+    double upper = log((1 - beta) / alpha);
+    double mean, variance, pairs;
+    scoreStats(result, mean, variance, pairs);
+    double margin = 1.96 * sqrt(variance / pairs);
+
+    const char *verdict = "inconclusive";
+    if (llr >= upper)
+        verdict = "H1 accepted (stronger)";
+    else if (llr <= lower)
+        verdict = "H0 accepted (not stronger)";
+
+    {
+        lock_guard<mutex> lock(reportMutex);
+        ostringstream line;
+        line << left << setw(10) << entrants[pairing.first].name << " vs " << setw(10) << entrants[pairing.second].name
+             << " +" << result.wins << " =" << result.draws << " -" << result.losses
+             << "  pairs " << result.pairs[0] << "/" << result.pairs[1] << "/" << result.pairs[2] << "/" << result.pairs[3] << "/" << result.pairs[4]
+             << fixed << setprecision(1)
+             << "  Elo " << scoreToElo(mean)
+             << " [" << scoreToElo(max(mean - margin, 0.001)) << ", " << scoreToElo(min(mean + margin, 0.999)) << "]"
+             << setprecision(2) << "  LLR " << llr << " (" << lower << ", " << upper << ")  " << verdict << "\n";
+        cout << line.str();
+        report << line.str();
+        report.flush();
+    }
+    finishedCount++;
+}
+
+void Tournament::worker(unsigned int seed)
+{
+    TicTacToe ai;
+    ai.seed(seed);
+    mt19937 rng(seed);
+    int pairingCount = pairings.size();
+    double lower = log(beta / (1 - alpha));
+    double upper = log((1 - beta) / alpha);
+
+    for (int next = seed % pairingCount; finishedCount < pairingCount; next = (next + 1) % pairingCount)
+    {
+        Pairing &pairing = pairings[next];
+        if (pairing.finished)
+            continue;
+
+        const Entrant &first = entrants[pairing.first];
+        const Entrant &second = entrants[pairing.second];
+        int opening[2];
+        int plies = randomOpening(rng, opening);
+        int points[2] = {halfPoints(playGame(ai, opening, plies, first.engine, second.engine), true),
+                         halfPoints(playGame(ai, opening, plies, second.engine, first.engine), false)};
+
+        Result snapshot;
+        double llr;
+        {
+            // Another worker may have stopped the pairing while these games ran;
+            // their results are dropped so the report matches what was counted
+            lock_guard<mutex> lock(pairing.mutex);
+            if (pairing.finished)
+                continue;
+
+            Result &result = pairing.result;
+            for (int p : points)
+            {
+                if (p == 2)
+                    result.wins++;
+                else if (p == 1)
+                    result.draws++;
+                else
+                    result.losses++;
+            }
+            result.pairs[points[0] + points[1]]++;
+
+            llr = logLikelihoodRatio(result);
+            int games = result.wins + result.draws + result.losses;
+            if (llr < upper && llr > lower && games + 2 <= maxGames)
+                continue;
+            pairing.finished = true;
+            snapshot = result;
+        }
+        finish(pairing, snapshot, llr);
+    }
+}
+
+Tournament::Tournament(bool gauntlet, int maxGamesPerPairing, int threads)
+    : maxGames(max(2, maxGamesPerPairing)), threadCount(threads > 0 ? threads : (int)max(1u, thread::hardware_concurrency()))
+{
+    entrants = {{"Tablebase", TicTacToe::TABLEBASE_ENGINE},
+                {"Minimax", TicTacToe::MINIMAX_ENGINE},
+                {"Random", TicTacToe::RANDOM_ENGINE}};
+
+    int count = 0;
+    for (int a = 0; a < (int)entrants.size(); a++)
+    {
+        for (int b = a + 1; b < (int)entrants.size(); b++)
+        {
+            if (!gauntlet || a == 0)
+                count++;
+        }
+    }
+
+    pairings = vector<Pairing>(count);
+    int index = 0;
+    for (int a = 0; a < (int)entrants.size(); a++)
+    {
+        for (int b = a + 1; b < (int)entrants.size(); b++)
+        {
+            if (!gauntlet || a == 0)
+            {
+                pairings[index].first = a;
+                pairings[index].second = b;
+                index++;
+            }
+        }
+    }
+}
+
+bool Tournament::run(const string &reportPath)
+{
+    report.open(reportPath, ios::trunc);
+    if (!report)
+    {
+        cout << "Could not open report file " << reportPath << "\n";
+        return false;
+    }
+
+    // Build the tablebase file once so workers only map it
+    TicTacToeTablebase warmup;
+    warmup.open("tictactoe.tb");
+    if (!warmup.isMapped() && TicTacToeTablebase::writeFile("tictactoe.tb", TicTacToeTablebase::generate()))
+        cout << "Tablebase written to tictactoe.tb\n";
+
+    cout << "Running " << pairings.size() << " pairing(s) on " << threadCount << " thread(s), up to "
+         << maxGames << " games each (SPRT elo0=" << elo0 << " elo1=" << elo1 << ")\n";
+
+    auto start = chrono::steady_clock::now();
+    vector<thread> threads;
+    for (int t = 0; t < threadCount; t++)
+        threads.emplace_back(&Tournament::worker, this, random_device{}() + t);
+    for (thread &t : threads)
+        t.join();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    int totalGames = 0;
+    for (const Pairing &pairing : pairings)
+        totalGames += pairing.result.wins + pairing.result.draws + pairing.result.losses;
+
+    ostringstream summary;
+    summary << totalGames << " games in " << fixed << setprecision(2) << seconds << "s ("
+            << setprecision(0) << totalGames / max(seconds, 1e-9) << " games/s)\n";
+    cout << summary.str();
+    report << summary.str();
+    return bool(report);
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "TicTacToe.h"
+
+// Pits Tic-Tac-Toe engines against each other on every core. Each pairing plays
+// game pairs with colours swapped and stops as soon as its SPRT reaches a decision.
+class Tournament
+{
+private:
+    struct Entrant
+    {
+        std::string name;
+        TicTacToe::Engine engine;
+    };
+
+    // Results are from the point of view of the first entrant. The two games of
+    // a pair share an opening, so the SPRT works on pair scores: pairs[k] counts
+    // the pairs in which the first entrant took k half-points (0-4).
+    struct Result
+    {
+        int wins = 0;
+        int draws = 0;
+        int losses = 0;
+        int pairs[5] = {0, 0, 0, 0, 0};
+    };
+
+    // `result` and `finished` only change under `mutex`, so the result that
+    // stops a pairing is exactly the one reported
+    struct Pairing
+    {
+        int first = 0;
+        int second = 0;
+        std::mutex mutex;
+        Result result;
+        std::atomic<bool> finished{false};
+    };
+
+    std::vector<Entrant> entrants;
+    std::vector<Pairing> pairings;
+    std::atomic<int> finishedCount{0};
+    int maxGames;
+    int threadCount;
+
+    // H0: the first entrant is no stronger (elo0), H1: it is stronger by elo1
+    double elo0 = 0;
+    double elo1 = 10;
+    double alpha = 0.05;
+    double beta = 0.05;
+
+    std::mutex reportMutex;
+    std::ofstream report;
+
+    static double eloToScore(double elo);
+
+    static double scoreToElo(double score);
+
+    // Mean and variance of the pair score, scaled to points per game. Half a
+    // lost pair and half a won pair are added so one-sided results (e.g. every
+    // pair split evenly) still have a finite variance.
+    static void scoreStats(const Result &result, double &mean, double &variance, double &pairs);
+
+    // Generalised SPRT log-likelihood ratio (normal approximation)
+    double logLikelihoodRatio(const Result &result) const;
+
+    // Both strong engines are deterministic, so each game pair starts from a
+    // random opening of 1-2 plies; the colour-swapped games share it.
+    static int randomOpening(std::mt19937 &rng, int opening[2]);
+
+    // Returns the winner's status for one headless game played on from the opening
+    static unsigned char playGame(TicTacToe &ai, const int opening[2], int openingPlies, TicTacToe::Engine xEngine, TicTacToe::Engine oEngine);
+
+    // Half-points (0-2) the first entrant took from a finished game
+    static int halfPoints(unsigned char status, bool firstPlaysX);
+
+    void finish(const Pairing &pairing, const Result &result, double llr);
+
+    void worker(unsigned int seed);
+
+public:
+    // Round robin plays every pair of entrants; a gauntlet plays the first against all others.
+    // threads = 0 uses one worker per core.
+    Tournament(bool gauntlet, int maxGamesPerPairing, int threads = 0);
+
+    bool run(const std::string &reportPath);
+};
@@ -0,0 +1,40 @@
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "BoardBatch.h"
+
+using namespace std;
+
+// Every batch size exercises a different split between the AVX2, SSE2 and scalar loops
+int main()
+{
+    mt19937 rng(1);
+    int failures = 0;
+    for (int count = 0; count <= 40; count++)
+    {
+        for (int trial = 0; trial < 200; trial++)
+        {
+            vector<uint16_t> xMasks(count);
+            vector<uint16_t> oMasks(count);
+            for (int i = 0; i < count; i++)
+            {
+                xMasks[i] = rng() & BoardBatch::FULL_BOARD;
+                oMasks[i] = rng() & BoardBatch::FULL_BOARD & ~xMasks[i];
+            }
+
+            vector<unsigned char> status(count);
+            vector<uint16_t> moves(count);
+            BoardBatch::evaluate(xMasks.data(), oMasks.data(), count, status.data());
+            BoardBatch::legalMoves(xMasks.data(), oMasks.data(), count, moves.data());
+            for (int i = 0; i < count; i++)
+            {
+                failures += status[i] != BoardBatch::evaluateOne(xMasks[i], oMasks[i]);
+                failures += moves[i] != (~(xMasks[i] | oMasks[i]) & BoardBatch::FULL_BOARD);
+            }
+        }
+    }
+
+    cout << failures << " failures\n";
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,101 @@
+#include <iostream>
+#include <map>
+#include <memory_resource>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Leaderboard.h"
+#include "PlayerScore.h"
+
+using namespace std;
+
+// Replays random results into a Leaderboard and a plain model of the same
+// totals, then checks the ranking and the rendered rows against the model.
+int main()
+{
+    mt19937 rng(3);
+    pmr::unsynchronized_pool_resource pool;
+    Leaderboard board(&pool);
+    map<string, PlayerScore> model;
+
+    int failures = 0;
+    for (int round = 0; round < 200; round++)
+    {
+        for (int i = 0; i < 50; i++)
+        {
+            string name = "P" + to_string(rng() % 120);
+            int score = rng() % 5 == 0 ? 0 : rng() % 300;
+            int wins = score > 0 ? 1 : 0;
+            board.add(name, score, wins);
+
+            auto found = model.find(name);
+            if (found == model.end())
+            {
+                model.emplace(name, PlayerScore(name, score, 1, wins));
+            }
+            else
+            {
+                found->second.score += score;
+                found->second.gamesPlayed++;
+                found->second.wins += wins;
+            }
+        }
+
+        // Ranks must be a permutation ordered by compScores
+        vector<const PlayerScore *> byRank(model.size(), nullptr);
+        for (const auto &player : model)
+        {
+            int rank = board.rankOfPlayer(player.first);
+            if (rank < 0 || rank >= (int)byRank.size() || byRank[rank])
+            {
+                failures++;
+                continue;
+            }
+            byRank[rank] = &player.second;
+        }
+        if (board.size() != (int)model.size())
+            failures++;
+        for (int rank = 1; rank < (int)byRank.size(); rank++)
+        {
+            if (byRank[rank - 1] && byRank[rank] && compScores(*byRank[rank], *byRank[rank - 1]))
+                failures++;
+        }
+
+        // A cached row must never show stale stats: every row on a page names
+        // the player at that rank with their current score
+        int firstRank = rng() % model.size();
+        ostringstream page;
+        streambuf *saved = cout.rdbuf(page.rdbuf());
+        board.displayPage("Test", firstRank, 10);
+        cout.rdbuf(saved);
+        string text = page.str();
+        size_t from = 0;
+        for (int rank = firstRank; rank < firstRank + 10 && rank < (int)byRank.size(); rank++)
+        {
+            if (!byRank[rank])
+                continue;
+            size_t at = text.find(" " + string(byRank[rank]->name) + " ", from);
+            size_t scoreAt = (at == string::npos) ? at : text.find(to_string(byRank[rank]->score), at);
+            size_t lineEnd = (at == string::npos) ? at : text.find('\n', at);
+            if (at == string::npos || scoreAt == string::npos || scoreAt > lineEnd)
+            {
+                failures++;
+                continue;
+            }
+            from = lineEnd;
+        }
+    }
+
+    // A cleared board starts empty and keeps working on the same pool
+    board.clear();
+    if (board.size() != 0 || board.rankOfPlayer("P0") != -1)
+        failures++;
+    board.add("P0", 10, 1);
+    if (board.size() != 1 || board.rankOfPlayer("P0") != 0)
+        failures++;
+
+    cout << model.size() << " players, " << failures << " failures\n";
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "ProfileManager.h"
+
+using namespace std;
+
+// Checks the segmented history against a linear scan of every match. Matches
+// are spaced so segments close on both the month boundary and the 256 cap.
+int main()
+{
+    static const char *gameNames[ProfileManager::GAME_COUNT] = {"TicTacToe", "NumberGuessing", "RockPaperScissors"};
+
+    mt19937 rng(7);
+    ProfileManager profiles;
+    vector<ProfileManager::Match> history;
+    int64_t start = 1700000000;
+    int64_t time = start;
+    for (int i = 0; i < 5000; i++)
+    {
+        time += (i % 1000 < 500) ? rng() % 600 : rng() % 40000;
+        ProfileManager::Match match{time, int(rng() % 3), int(rng() % 300), bool(rng() & 1)};
+        profiles.recordMatch("Ana", gameNames[match.game], match.score, match.won, match.time);
+        profiles.recordMatch("Bo", gameNames[match.game], 1, false, match.time);
+        history.push_back(match);
+    }
+
+    int failures = 0;
+    for (int query = 0; query < 2000; query++)
+    {
+        int64_t from = start + rng() % (time - start);
+        int64_t to = from + rng() % 5000000;
+        ProfileManager::Stats actual = profiles.statsBetween("Ana", from, to);
+        ProfileManager::Stats expected;
+        for (const ProfileManager::Match &match : history)
+        {
+            if (match.time >= from && match.time <= to)
+                expected.add(match);
+        }
+        failures += actual.games != expected.games || actual.wins != expected.wins || actual.score != expected.score;
+    }
+
+    for (int game = 0; game < ProfileManager::GAME_COUNT; game++)
+    {
+        ProfileManager::Stats expected;
+        for (const ProfileManager::Match &match : history)
+        {
+            if (match.game == game)
+                expected.add(match);
+        }
+        ProfileManager::Stats actual = profiles.totals("Ana", game);
+        failures += actual.games != expected.games || actual.wins != expected.wins || actual.score != expected.score;
+    }
+
+    vector<ProfileManager::Match> last = profiles.lastGames("Ana", 700);
+    failures += last.size() != 700;
+    for (int i = 0; i < (int)last.size(); i++)
+    {
+        const ProfileManager::Match &match = history[history.size() - 1 - i];
+        failures += last[i].time != match.time || last[i].game != match.game || last[i].score != match.score || last[i].won != match.won;
+    }
+
+    // A clock stepped back, within a month and across a month boundary, must
+    // not hide earlier matches: late-stamped matches keep the previous time
+    int64_t day = 86400;
+    const int64_t stamped[] = {start, start + 2 * day, start + 3 * day, start + day, start + 40 * day, start + 20 * day};
+    const int64_t recorded[] = {start, start + 2 * day, start + 3 * day, start + 3 * day, start + 40 * day, start + 40 * day};
+    for (int64_t t : stamped)
+        profiles.recordMatch("Di", "TicTacToe", 1, false, t);
+    failures += profiles.statsBetween("Di", start + 3 * day, start + 3 * day).games != 2;
+    failures += profiles.statsBetween("Di", start + 40 * day, start + 40 * day).games != 2;
+    failures += profiles.statsBetween("Di", start, start + 40 * day).games != 6;
+    vector<ProfileManager::Match> clamped = profiles.lastGames("Di", 6);
+    for (int i = 0; i < 6; i++)
+        failures += clamped[i].time != recorded[5 - i];
+
+    failures += !profiles.hasProfile("Bo") || profiles.hasProfile("Cy") || profiles.lastGames("Cy", 5).size() != 0;
+
+    cout << failures << " failures\n";
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+
+#include "BoardBatch.h"
+#include "TicTacToe.h"
+#include "TicTacToeTablebase.h"
+
+using namespace std;
+
+// Plain negamax over strings, independent of the engine code: +1 if the side
+// to move wins with perfect play, 0 for a draw, -1 for a loss.
+static map<string, int> memo;
+
+static bool wins(const string &board, char mark)
+{
+    static const int lines[8][3] = {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {0, 3, 6}, {1, 4, 7}, {2, 5, 8}, {0, 4, 8}, {2, 4, 6}};
+    for (const auto &line : lines)
+    {
+        if (board[line[0]] == mark && board[line[1]] == mark && board[line[2]] == mark)
+            return true;
+    }
+    return false;
+}
+
+static int negamax(string &board, char mark)
+{
+    auto found = memo.find(board);
+    if (found != memo.end())
+        return found->second;
+
+    char other = (mark == 'X') ? 'O' : 'X';
+    int best = -2;
+    bool moved = false;
+    for (int i = 0; i < 9; i++)
+    {
+        if (board[i] != ' ')
+            continue;
+        moved = true;
+        board[i] = mark;
+        int value = wins(board, mark) ? 1 : -negamax(board, other);
+        board[i] = ' ';
+        best = max(best, value);
+    }
+    if (!moved)
+        best = 0;
+    memo[board] = best;
+    return best;
+}
+
+// Value for the mover after playing move, or -2 if the move is illegal
+static int valueOfMove(string board, char mark, int move)
+{
+    if (move < 0 || move > 8 || board[move] != ' ')
+        return -2;
+    board[move] = mark;
+    if (wins(board, mark))
+        return 1;
+    return -negamax(board, (mark == 'X') ? 'O' : 'X');
+}
+
+static set<string> reachable;
+
+static void collect(string &board, char mark)
+{
+    if (!reachable.insert(board).second || wins(board, 'X') || wins(board, 'O') || board.find(' ') == string::npos)
+        return;
+    for (int i = 0; i < 9; i++)
+    {
+        if (board[i] != ' ')
+            continue;
+        board[i] = mark;
+        collect(board, (mark == 'X') ? 'O' : 'X');
+        board[i] = ' ';
+    }
+}
+
+int main()
+{
+    TicTacToeTablebase tablebase;
+    tablebase.open("missing-tablebase-for-test.tb");
+    TicTacToe minimax;
+
+    string empty(9, ' ');
+    collect(empty, 'X');
+
+    int positions = 0;
+    int failures = 0;
+    for (const string &position : reachable)
+    {
+        if (wins(position, 'X') || wins(position, 'O') || position.find(' ') == string::npos)
+            continue;
+        positions++;
+
+        int xs = 0;
+        int os = 0;
+        for (char c : position)
+        {
+            xs += c == 'X';
+            os += c == 'O';
+        }
+        char mark = (xs == os) ? 'X' : 'O';
+        string board = position;
+        int optimal = negamax(board, mark);
+
+        int tablebaseValue = valueOfMove(position, mark, tablebase.bestMove(position.c_str()));
+        int minimaxValue = valueOfMove(position, mark, minimax.chooseMove(position.c_str(), mark, TicTacToe::MINIMAX_ENGINE));
+        if (tablebaseValue != optimal || minimaxValue != optimal)
+        {
+            if (failures++ < 10)
+                cout << "[" << position << "] " << mark << " to move: optimal " << optimal << ", tablebase " << tablebaseValue << ", minimax " << minimaxValue << "\n";
+        }
+    }
+
+    cout << positions << " positions, " << failures << " failures\n";
+    return (failures == 0 && positions == 4520) ? 0 : 1;
+}